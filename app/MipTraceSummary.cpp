@@ -0,0 +1,152 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file ../app/MipTraceSummary.cpp
+ * @brief Summary of a node trace written by the MIP solver with the option
+ * mip_trace_file
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Counts {
+  long long nodes = 0;
+  long long lp_iterations = 0;
+  double propagation_time = 0.0;
+};
+
+void addNode(Counts& counts, long long lp_iterations,
+             double propagation_time) {
+  ++counts.nodes;
+  counts.lp_iterations += lp_iterations;
+  counts.propagation_time += propagation_time;
+}
+
+void reportCounts(const char* title,
+                  const std::map<std::string, Counts>& countsByKey,
+                  long long numNodes) {
+  printf("\n%-18s %10s %8s %12s %10s\n", title, "nodes", "share",
+         "lp iters", "prop. time");
+  for (const std::pair<const std::string, Counts>& entry : countsByKey)
+    printf("%-18s %10lld %7.2f%% %12lld %10.3f\n", entry.first.c_str(),
+           entry.second.nodes, 100.0 * entry.second.nodes / numNodes,
+           entry.second.lp_iterations, entry.second.propagation_time);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    printf("usage: %s <trace file>\n", argv[0]);
+    return 1;
+  }
+
+  std::ifstream in(argv[1]);
+  if (!in.is_open()) {
+    printf("cannot open %s\n", argv[1]);
+    return 1;
+  }
+
+  std::string line;
+  // skip the header
+  std::getline(in, line);
+
+  Counts total;
+  int maxDepth = 0;
+  long long sumDepth = 0;
+  double minLowerBound = 0.0;
+  double maxLowerBound = 0.0;
+  std::map<std::string, Counts> bySelection;
+  std::map<std::string, Counts> byResult;
+  std::map<int, long long> branchingCount;
+  std::vector<long long> depthCount;
+
+  std::vector<std::string> fields;
+  while (std::getline(in, line)) {
+    if (line.empty()) continue;
+    fields.clear();
+    std::stringstream stream(line);
+    std::string field;
+    while (std::getline(stream, field, ',')) fields.push_back(field);
+    // node,depth,selection,branching_col,lower_bound,estimate,
+    // lp_iterations,propagation_time,cuts_in_lp,result
+    if (fields.size() != 10) {
+      printf("skipping malformed line: %s\n", line.c_str());
+      continue;
+    }
+
+    int depth = std::atoi(fields[1].c_str());
+    int branchingCol = std::atoi(fields[3].c_str());
+    double lowerBound = std::atof(fields[4].c_str());
+    long long lpIterations = std::atoll(fields[6].c_str());
+    double propagationTime = std::atof(fields[7].c_str());
+
+    if (total.nodes == 0) {
+      minLowerBound = lowerBound;
+      maxLowerBound = lowerBound;
+    } else {
+      minLowerBound = std::min(minLowerBound, lowerBound);
+      maxLowerBound = std::max(maxLowerBound, lowerBound);
+    }
+    addNode(total, lpIterations, propagationTime);
+    addNode(bySelection[fields[2]], lpIterations, propagationTime);
+    addNode(byResult[fields[9]], lpIterations, propagationTime);
+    if (branchingCol != -1) ++branchingCount[branchingCol];
+
+    maxDepth = std::max(maxDepth, depth);
+    sumDepth += depth;
+    if ((int)depthCount.size() <= depth) depthCount.resize(depth + 1);
+    ++depthCount[depth];
+  }
+
+  if (total.nodes == 0) {
+    printf("trace contains no nodes\n");
+    return 0;
+  }
+
+  printf("Nodes              %lld\n", total.nodes);
+  printf("LP iterations      %lld (%.1f per node)\n", total.lp_iterations,
+         double(total.lp_iterations) / total.nodes);
+  printf("Propagation time   %.3f\n", total.propagation_time);
+  printf("Depth              %d (max), %.1f (average)\n", maxDepth,
+         double(sumDepth) / total.nodes);
+  printf("Lower bound        %.12g (min), %.12g (max)\n", minLowerBound,
+         maxLowerBound);
+
+  reportCounts("Node selection", bySelection, total.nodes);
+  reportCounts("Node result", byResult, total.nodes);
+
+  printf("\n%-18s %10s\n", "Depth", "nodes");
+  for (int depth = 0; depth <= maxDepth; ++depth)
+    if (depthCount[depth] != 0)
+      printf("%-18d %10lld\n", depth, depthCount[depth]);
+
+  std::vector<std::pair<long long, int>> branchings;
+  for (const std::pair<const int, long long>& entry : branchingCount)
+    branchings.emplace_back(-entry.second, entry.first);
+  std::sort(branchings.begin(), branchings.end());
+  if (branchings.size() > 10) branchings.resize(10);
+
+  printf("\n%-18s %10s\n", "Branching column", "nodes");
+  for (const std::pair<long long, int>& branching : branchings)
+    printf("%-18d %10lld\n", branching.second, -branching.first);
+
+  return 0;
+}
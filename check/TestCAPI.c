@@ -641,6 +641,24 @@ void full_api_mip() {
   assert( return_status == kHighsStatusOk );
   assert( mip_node_count == 1 );
 
+  // Solve again keeping the two best distinct solutions in the pool
+  Highs_setIntOptionValue(highs, "mip_solution_pool_size", 2);
+  Highs_clearSolver(highs);
+  return_status = Highs_run(highs);
+  assert( return_status == kHighsStatusOk );
+  HighsInt num_pool_solutions = Highs_getNumMipPoolSolutions(highs);
+  assert( num_pool_solutions >= 1 );
+  assert( num_pool_solutions <= 2 );
+  double pool_objective;
+  return_status = Highs_getMipPoolSolution(highs, 0, &pool_objective, col_value);
+  assert( return_status == kHighsStatusOk );
+  assertDoubleValuesEqual("pool_objective", pool_objective, Highs_getObjectiveValue(highs));
+  return_status = Highs_getMipPoolSolution(highs, num_pool_solutions, &pool_objective, col_value);
+  assert( return_status == kHighsStatusError );
+
+  free(col_value);
+  free(row_value);
+  Highs_destroy(highs);
 }
 
 void full_api_qp() {
@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "catch.hpp"
+#include "mip/HighsCutSelector.h"
+#include "util/HighsRandom.h"
+
+const bool dev_run = false;
+
+TEST_CASE("CutSelector", "[mip]") {
+  HighsRandom randgen;
+  HighsInt numCol = 50;
+  HighsInt numCut = 200;
+  double maxPar = 0.1;
+
+  std::vector<HighsInt> colInds(numCol);
+  std::iota(colInds.begin(), colInds.end(), 0);
+
+  std::vector<HighsInt> Rstart{0};
+  std::vector<HighsInt> Rindex;
+  std::vector<double> Rvalue;
+  std::vector<double> normalization;
+  for (HighsInt i = 0; i != numCut; ++i) {
+    randgen.shuffle(colInds.data(), colInds.size());
+    HighsInt len = randgen.integer(1, 8);
+    std::sort(colInds.begin(), colInds.begin() + len);
+    double norm = 0.0;
+    for (HighsInt j = 0; j != len; ++j) {
+      double val = randgen.real(-1.0, 1.0);
+      Rindex.push_back(colInds[j]);
+      Rvalue.push_back(val);
+      norm += val * val;
+    }
+    Rstart.push_back(Rindex.size());
+    normalization.push_back(1.0 / std::sqrt(norm));
+  }
+
+  auto parallelism = [&](HighsInt cut1, HighsInt cut2) {
+    std::vector<double> dense(numCol);
+    for (HighsInt j = Rstart[cut1]; j != Rstart[cut1 + 1]; ++j)
+      dense[Rindex[j]] = Rvalue[j];
+    double dotprod = 0.0;
+    for (HighsInt j = Rstart[cut2]; j != Rstart[cut2 + 1]; ++j)
+      dotprod += dense[Rindex[j]] * Rvalue[j];
+    return dotprod * normalization[cut1] * normalization[cut2];
+  };
+
+  HighsCutSelector cutSelector;
+  for (HighsInt round = 0; round != 2; ++round) {
+    cutSelector.reset(numCol);
+    std::vector<HighsInt> selected;
+    for (HighsInt i = 0; i != numCut; ++i) {
+      double expectedMaxPar = 0.0;
+      for (HighsInt cut : selected)
+        expectedMaxPar = std::max(expectedMaxPar, parallelism(cut, i));
+
+      HighsInt len = Rstart[i + 1] - Rstart[i];
+      REQUIRE(std::fabs(cutSelector.maxParallelism(&Rindex[Rstart[i]],
+                                                   &Rvalue[Rstart[i]], len,
+                                                   normalization[i]) -
+                        expectedMaxPar) <= 1e-12);
+
+      bool isSelected =
+          cutSelector.trySelect(&Rindex[Rstart[i]], &Rvalue[Rstart[i]], len,
+                                normalization[i], maxPar);
+      REQUIRE(isSelected == (expectedMaxPar <= maxPar));
+      if (isSelected) selected.push_back(i);
+    }
+
+    REQUIRE(cutSelector.numSelected() == (HighsInt)selected.size());
+    if (dev_run)
+      printf("selected %d of %d cuts\n", int(selected.size()), int(numCut));
+  }
+}
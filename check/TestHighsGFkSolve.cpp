@@ -100,3 +100,46 @@ TEST_CASE("GFkSolve", "[mip]") {
   testGFkSolve<7>(Avalue, Aindex, Astart, numRow);
   testGFkSolve<11>(Avalue, Aindex, Astart, numRow);
 }
+
+TEST_CASE("GFkSolve-dependent-rows", "[mip]") {
+  std::vector<HighsInt> Avalue;
+  std::vector<HighsInt> Aindex;
+  std::vector<HighsInt> Astart;
+
+  HighsRandom randgen;
+  HighsInt numRow = 60;
+  HighsInt numCol = 150;
+  HighsInt numCopiedRows = 29;
+
+  std::vector<HighsInt> rowInds(numRow - numCopiedRows);
+  std::iota(rowInds.begin(), rowInds.end(), 0);
+
+  Astart.push_back(0);
+
+  // rows numRow - numCopiedRows - 1 to numRow - 2 are copies of the first
+  // rows, so that the system has linearly dependent rows with a zero right
+  // hand side spanning several 64 bit words in the dense GF(2) elimination
+  for (HighsInt i = 0; i != numCol; ++i) {
+    randgen.shuffle(rowInds.data(), rowInds.size());
+    HighsInt numentry = randgen.integer(5, 11);
+
+    for (HighsInt j = 0; j != numentry; ++j) {
+      HighsInt val = randgen.integer(-10000, 10001);
+      if (val == 0) ++val;
+      HighsInt row = rowInds[j] == numRow - numCopiedRows - 1
+                         ? numRow - 1
+                         : rowInds[j];
+      Avalue.push_back(val);
+      Aindex.push_back(row);
+      if (row < numCopiedRows) {
+        Avalue.push_back(val);
+        Aindex.push_back(row + numRow - numCopiedRows - 1);
+      }
+    }
+
+    Astart.push_back(Avalue.size());
+  }
+
+  testGFkSolve<2>(Avalue, Aindex, Astart, numRow);
+  testGFkSolve<3>(Avalue, Aindex, Astart, numRow);
+}
@@ -1,6 +1,13 @@
+#include <algorithm>
+#include <fstream>
+
 #include "Highs.h"
 #include "SpecialLps.h"
+#include "TestTempFile.h"
 #include "catch.hpp"
+#include "mip/HighsMipSolver.h"
+#include "mip/HighsMipSolverData.h"
+#include "parallel/HighsParallel.h"
 
 const bool dev_run = false;
 const double double_equal_tolerance = 1e-5;
@@ -11,6 +18,8 @@ void solve(Highs& highs, std::string presolve,
            const double require_iteration_count = -1);
 void distillationMIP(Highs& highs);
 void rowlessMIP(Highs& highs);
+void graphColouringMIP(Highs& highs);
+std::unique_ptr<HighsMipSolver> runMipSolver(Highs& highs);
 
 TEST_CASE("MIP-distillation", "[highs_test_mip_solver]") {
   Highs highs;
@@ -24,6 +33,425 @@ TEST_CASE("MIP-rowless", "[highs_test_mip_solver]") {
   rowlessMIP(highs);
 }
 
+TEST_CASE("MIP-symmetry-node-limit", "[highs_test_mip_solver]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  graphColouringMIP(highs);
+  const double optimal_objective = 4;
+  solve(highs, "on", HighsModelStatus::kOptimal, optimal_objective);
+  const HighsInt max_nodes = 2;
+  std::unique_ptr<HighsMipSolver> solver = runMipSolver(highs);
+  REQUIRE(solver->mipdata_->num_symmetry_nodes > max_nodes);
+  // A search for symmetries that is stopped after very few nodes yields
+  // a subgroup of the symmetries, so the optimal objective is unchanged
+  highs.setOptionValue("mip_symmetry_max_nodes", max_nodes);
+  solve(highs, "on", HighsModelStatus::kOptimal, optimal_objective);
+  // The limit holds for each search, which is repeated after a restart
+  highs.setOptionValue("mip_symmetry_max_nodes", max_nodes);
+  solver = runMipSolver(highs);
+  REQUIRE(solver->mipdata_->num_symmetry_nodes > 0);
+  REQUIRE(solver->mipdata_->num_symmetry_nodes <=
+          max_nodes * (1 + solver->mipdata_->numRestarts));
+}
+
+TEST_CASE("MIP-restart-pools", "[highs_test_mip_solver]") {
+  // The conflicts and cuts that are carried over the restart of this model
+  // use general integer and continuous columns that are transformed by
+  // presolve after the restart, and yield a suboptimal solution unless they
+  // are transformed too
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/restart_mip.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  const double optimal_objective = -924.385860228;
+  solve(highs, "on", HighsModelStatus::kOptimal, optimal_objective);
+  REQUIRE(runMipSolver(highs)->mipdata_->numRestarts > 0);
+  solve(highs, "off", HighsModelStatus::kOptimal, optimal_objective);
+}
+
+TEST_CASE("MIP-root-racers", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  highs.setOptionValue("mip_root_racers", 3);
+  const double optimal_objective = 8966406.49152;
+  solve(highs, "on", HighsModelStatus::kOptimal, optimal_objective);
+  // Without presolve the main solver does not restart, so the cuts of
+  // the racers are passed to it. The options are reset by solve()
+  highs.setOptionValue("mip_root_racers", 3);
+  solve(highs, "off", HighsModelStatus::kOptimal, optimal_objective);
+  highs.setOptionValue("mip_root_racers", 3);
+  highs.setOptionValue("presolve", "off");
+  REQUIRE(runMipSolver(highs)->mipdata_->num_racer_cuts > 0);
+}
+
+TEST_CASE("MIP-parallel-separation", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  highs.setOptionValue("mip_parallel_separation", true);
+  const double optimal_objective = 8966406.49152;
+  solve(highs, "on", HighsModelStatus::kOptimal, optimal_objective);
+  highs.setOptionValue("mip_parallel_separation", true);
+  REQUIRE(runMipSolver(highs)->mipdata_->num_parallel_separation_cuts > 0);
+}
+
+TEST_CASE("MIP-parallel-separation-repeat", "[highs_test_mip_solver]") {
+  // The MIP solver is run directly, so that the LP iterations of the search
+  // can be compared
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  highs.setOptionValue("mip_parallel_separation", true);
+  auto runParallel = [&]() {
+    std::unique_ptr<HighsMipSolver> solver = runMipSolver(highs);
+    REQUIRE(solver->modelstatus_ == HighsModelStatus::kOptimal);
+    return std::make_pair(solver->node_count_,
+                          solver->mipdata_->total_lp_iterations);
+  };
+
+  // Cuts found by concurrent separators are merged in the same way in each
+  // run, so the node and LP iteration counts are repeated
+  auto result = runParallel();
+  if (dev_run)
+    printf("Parallel separation: %d nodes and %d LP iterations\n",
+           int(result.first), int(result.second));
+  for (HighsInt k = 0; k < 3; ++k) REQUIRE(result == runParallel());
+}
+
+TEST_CASE("MIP-node-memory-limit", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  highs.setOptionValue("mip_node_memory_limit", 0.01);
+  const double optimal_objective = 8966406.49152;
+  solve(highs, "on", HighsModelStatus::kOptimal, optimal_objective);
+  highs.setOptionValue("mip_node_memory_limit", 0.01);
+  std::unique_ptr<HighsMipSolver> solver = runMipSolver(highs);
+  const HighsNodeQueue& nodequeue = solver->mipdata_->nodequeue;
+  if (dev_run)
+    printf("Spilled %d nodes and reloaded %d nodes\n",
+           int(nodequeue.getNumNodesSpilled()),
+           int(nodequeue.getNumNodesReloaded()));
+  REQUIRE(nodequeue.getNumNodesSpilled() > 0);
+  REQUIRE(nodequeue.getNumNodesReloaded() > 0);
+}
+
+TEST_CASE("MIP-background-heuristics", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  highs.setOptionValue("mip_background_heuristics", true);
+  // The result of a background sub-MIP is then collected after a fixed
+  // amount of work, rather than whenever the sub-MIP has finished
+  highs.setOptionValue("mip_deterministic", true);
+  const double optimal_objective = 8966406.49152;
+  solve(highs, "on", HighsModelStatus::kOptimal, optimal_objective);
+  highs.setOptionValue("mip_background_heuristics", true);
+  highs.setOptionValue("mip_deterministic", true);
+  REQUIRE(runMipSolver(highs)->mipdata_->num_background_sub_mips > 0);
+}
+
+TEST_CASE("MIP-deterministic", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  auto runParallel = [&](double work_limit) {
+    // Solve from scratch each time, rather than from the previous solution
+    REQUIRE(highs.clearSolver() == HighsStatus::kOk);
+    highs.setOptionValue("mip_background_heuristics", true);
+    highs.setOptionValue("mip_parallel_separation", true);
+    highs.setOptionValue("mip_work_limit", work_limit);
+    highs.run();
+    return std::make_tuple(highs.getModelStatus(),
+                           highs.getInfo().mip_node_count,
+                           highs.getInfo().objective_function_value);
+  };
+
+  // The same node sequence and incumbent result from repeated solves
+  auto result = runParallel(kHighsInf);
+  REQUIRE(std::get<0>(result) == HighsModelStatus::kOptimal);
+  REQUIRE(result == runParallel(kHighsInf));
+
+  // The work limit is deterministic
+  result = runParallel(1000);
+  REQUIRE(std::get<0>(result) == HighsModelStatus::kIterationLimit);
+  REQUIRE(result == runParallel(1000));
+}
+
+TEST_CASE("MIP-parallel-cliquetable", "[highs_test_mip_solver]") {
+  // Clique extraction and separation use parallelism for any clique table
+  auto runParallel = [&](const std::string& model) {
+    Highs highs;
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    highs.setOptionValue("mip_min_cliquetable_entries_for_parallelism", 0);
+    highs.run();
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    return std::make_pair(highs.getInfo().mip_node_count,
+                          highs.getInfo().objective_function_value);
+  };
+
+  auto result = runParallel("lseu");
+  REQUIRE(std::fabs(result.second - 1120) < 1e-6);
+  REQUIRE(result == runParallel("lseu"));
+  result = runParallel("p0548");
+  REQUIRE(std::fabs(result.second - 8691) < 1e-6);
+  REQUIRE(result == runParallel("p0548"));
+}
+
+TEST_CASE("MIP-improvement-heuristics", "[highs_test_mip_solver]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("mip_improvement_heuristics", true);
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/lseu.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  solve(highs, "on", HighsModelStatus::kOptimal, 1120);
+  // The incumbent is optimal by the time local branching and proximity
+  // search first run, so they can only be checked to have solved sub-MIPs.
+  // The options are reset by solve()
+  highs.setOptionValue("mip_improvement_heuristics", true);
+  REQUIRE(runMipSolver(highs)->mipdata_->num_improvement_sub_mips > 0);
+  filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  solve(highs, "on", HighsModelStatus::kOptimal, 8966406.49152);
+}
+
+TEST_CASE("MIP-conflict-first-uip", "[highs_test_mip_solver]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("mip_conflict_first_uip", true);
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/lseu.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  solve(highs, "on", HighsModelStatus::kOptimal, 1120);
+
+  // Learning only the first UIP conflict of the first depth level with a
+  // conflict yields fewer conflicts than the default analysis
+  filename = std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  solve(highs, "on", HighsModelStatus::kOptimal, 1201500);
+  highs.setOptionValue("mip_conflict_first_uip", true);
+  solve(highs, "on", HighsModelStatus::kOptimal, 1201500);
+  const int64_t num_conflicts_learned =
+      runMipSolver(highs)->mipdata_->conflictPool.getNumConflictsLearned();
+  REQUIRE(num_conflicts_learned > 0);
+  highs.setOptionValue("mip_conflict_first_uip", true);
+  const int64_t num_first_uip_conflicts_learned =
+      runMipSolver(highs)->mipdata_->conflictPool.getNumConflictsLearned();
+  if (dev_run)
+    printf("Conflicts learned: %d by default, %d in first UIP mode\n",
+           int(num_conflicts_learned), int(num_first_uip_conflicts_learned));
+  REQUIRE(num_first_uip_conflicts_learned > 0);
+  REQUIRE(num_first_uip_conflicts_learned < num_conflicts_learned);
+}
+
+TEST_CASE("MIP-checkpoint", "[highs_test_mip_solver]") {
+  const std::string checkpoint_file = tempFilePath("bell5.ckpt");
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  // There is no checkpoint before the search stopped with open nodes
+  REQUIRE(highs.writeMipCheckpoint(checkpoint_file) == HighsStatus::kError);
+  highs.setOptionValue("mip_max_nodes", 50);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kIterationLimit);
+  // ... nor unless it is requested
+  REQUIRE(highs.writeMipCheckpoint(checkpoint_file) == HighsStatus::kError);
+  highs.setOptionValue("mip_keep_checkpoint", true);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kIterationLimit);
+  REQUIRE(highs.writeMipCheckpoint(checkpoint_file) == HighsStatus::kOk);
+  // Clearing the solver discards the checkpoint
+  REQUIRE(highs.clearSolver() == HighsStatus::kOk);
+  REQUIRE(highs.writeMipCheckpoint(checkpoint_file) == HighsStatus::kError);
+
+  // Resume the search in a new instance and solve to optimality
+  Highs resumed;
+  if (!dev_run) resumed.setOptionValue("output_flag", false);
+  REQUIRE(resumed.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(resumed.readMipCheckpoint(checkpoint_file) == HighsStatus::kOk);
+  solve(resumed, "on", HighsModelStatus::kOptimal, 8966406.49152);
+  REQUIRE(resumed.getInfo().mip_node_count > 50);
+  // The search finished, so no checkpoint is kept
+  REQUIRE(resumed.writeMipCheckpoint(checkpoint_file) == HighsStatus::kError);
+
+  // A checkpoint is ignored for a different model
+  filename = std::string(HIGHS_DIR) + "/check/instances/lseu.mps";
+  REQUIRE(resumed.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(resumed.readMipCheckpoint(checkpoint_file) == HighsStatus::kOk);
+  solve(resumed, "on", HighsModelStatus::kOptimal, 1120);
+
+  // A file that is not a checkpoint is rejected
+  REQUIRE(resumed.readMipCheckpoint(filename) == HighsStatus::kError);
+  std::remove(checkpoint_file.c_str());
+}
+
+TEST_CASE("MIP-trace", "[highs_test_mip_solver]") {
+  const std::string trace_file = tempFilePath("bell5.trace.csv");
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("mip_trace_file", trace_file);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  solve(highs, "on", HighsModelStatus::kOptimal, 8966406.49152);
+
+  // The trace has a header and a record for each node of the search
+  std::ifstream trace(trace_file);
+  std::string line;
+  REQUIRE(std::getline(trace, line));
+  REQUIRE(line.substr(0, 5) == "node,");
+  HighsInt num_records = 0;
+  while (std::getline(trace, line)) ++num_records;
+  REQUIRE(num_records > 0);
+  REQUIRE(num_records <= highs.getInfo().mip_node_count);
+  trace.close();
+  std::remove(trace_file.c_str());
+}
+
+TEST_CASE("MIP-solution-pool", "[highs_test_mip_solver]") {
+  const HighsInt pool_size = 5;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("mip_solution_pool_size", pool_size);
+  // The gap tolerances apply to the worst solution in the pool, so they
+  // are zero for the first solution to be optimal
+  highs.setOptionValue("mip_rel_gap", 0.0);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  solve(highs, "on", HighsModelStatus::kOptimal, 8966406.49152);
+
+  // The pool holds distinct feasible solutions, the first of which is the
+  // optimal solution
+  const std::vector<HighsMipPoolSolution>& pool = highs.getMipSolutionPool();
+  const HighsLp& lp = highs.getLp();
+  const double tolerance = 1e-6;
+  if (dev_run)
+    printf("Solution pool has %d solutions\n", int(pool.size()));
+  REQUIRE(pool.size() > 1);
+  REQUIRE((HighsInt)pool.size() <= pool_size);
+  REQUIRE(std::fabs(pool[0].objective - highs.getInfo().objective_function_value) <
+          double_equal_tolerance);
+  for (size_t k = 0; k < pool.size(); k++) {
+    const std::vector<double>& col_value = pool[k].col_value;
+    REQUIRE((HighsInt)col_value.size() == lp.num_col_);
+    if (k > 0) REQUIRE(pool[k - 1].objective <= pool[k].objective);
+
+    double objective = lp.offset_;
+    for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+      objective += lp.col_cost_[iCol] * col_value[iCol];
+      REQUIRE(col_value[iCol] >= lp.col_lower_[iCol] - tolerance);
+      REQUIRE(col_value[iCol] <= lp.col_upper_[iCol] + tolerance);
+    }
+    REQUIRE(std::fabs(objective - pool[k].objective) <=
+            tolerance * std::max(1.0, std::fabs(objective)));
+
+    std::vector<double> row_value;
+    lp.a_matrix_.productQuad(row_value, col_value);
+    for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
+      REQUIRE(row_value[iRow] >= lp.row_lower_[iRow] - tolerance);
+      REQUIRE(row_value[iRow] <= lp.row_upper_[iRow] + tolerance);
+    }
+
+    for (size_t l = 0; l < k; l++) {
+      bool distinct = false;
+      for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+        if (lp.integrality_[iCol] == HighsVarType::kInteger &&
+            std::round(col_value[iCol]) != std::round(pool[l].col_value[iCol]))
+          distinct = true;
+      REQUIRE(distinct);
+    }
+  }
+
+  // Without a pool size no solutions are kept
+  highs.setOptionValue("mip_solution_pool_size", 0);
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getMipSolutionPool().empty());
+}
+
+TEST_CASE("MIP-solution-pool-best", "[highs_test_mip_solver]") {
+  // A small pure integer model whose best solutions are found by
+  // enumerating all integer assignments
+  HighsLp lp;
+  lp.num_col_ = 7;
+  lp.num_row_ = 3;
+  lp.col_cost_ = {5, 4, 6, 2, 3, 3, 4};
+  lp.col_lower_.assign(lp.num_col_, 0);
+  lp.col_upper_ = {1, 1, 1, 1, 1, 3, 3};
+  lp.row_lower_ = {7, -kHighsInf, -kHighsInf};
+  lp.row_upper_ = {kHighsInf, 3, 2};
+  lp.a_matrix_.format_ = MatrixFormat::kRowwise;
+  lp.a_matrix_.num_col_ = lp.num_col_;
+  lp.a_matrix_.num_row_ = lp.num_row_;
+  lp.a_matrix_.start_ = {0, 7, 12, 16};
+  lp.a_matrix_.index_ = {0, 1, 2, 3, 4, 5, 6, 0, 1, 2, 3, 4, 0, 2, 5, 6};
+  lp.a_matrix_.value_ = {3, 2, 4, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, -1, 1, -1};
+  lp.integrality_.assign(lp.num_col_, HighsVarType::kInteger);
+
+  std::vector<double> objectives;
+  std::vector<double> col_value(lp.num_col_);
+  std::vector<double> row_value;
+  HighsInt num_assignment = 1;
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+    num_assignment *= HighsInt(lp.col_upper_[iCol]) + 1;
+  for (HighsInt k = 0; k < num_assignment; k++) {
+    HighsInt code = k;
+    double objective = 0;
+    for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+      HighsInt range = HighsInt(lp.col_upper_[iCol]) + 1;
+      col_value[iCol] = code % range;
+      code /= range;
+      objective += lp.col_cost_[iCol] * col_value[iCol];
+    }
+    lp.a_matrix_.productQuad(row_value, col_value);
+    bool feasible = true;
+    for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++)
+      if (row_value[iRow] < lp.row_lower_[iRow] ||
+          row_value[iRow] > lp.row_upper_[iRow])
+        feasible = false;
+    if (feasible) objectives.push_back(objective);
+  }
+  std::sort(objectives.begin(), objectives.end());
+
+  const HighsInt pool_size = 8;
+  REQUIRE((HighsInt)objectives.size() > pool_size);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  for (HighsInt pass = 0; pass < 2; pass++) {
+    // The second pass maximizes the negated objective
+    const double sense = pass == 0 ? 1 : -1;
+    if (pass == 1) {
+      lp.sense_ = ObjSense::kMaximize;
+      for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+        lp.col_cost_[iCol] = -lp.col_cost_[iCol];
+    }
+    highs.setOptionValue("mip_solution_pool_size", pool_size);
+    REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+
+    const std::vector<HighsMipPoolSolution>& pool = highs.getMipSolutionPool();
+    REQUIRE((HighsInt)pool.size() == pool_size);
+    for (HighsInt k = 0; k < pool_size; k++) {
+      if (dev_run)
+        printf("Pool solution %d has objective %g, enumeration gives %g\n",
+               int(k), pool[k].objective, sense * objectives[k]);
+      REQUIRE(std::fabs(pool[k].objective - sense * objectives[k]) <
+              double_equal_tolerance);
+    }
+  }
+}
+
 TEST_CASE("MIP-integrality", "[highs_test_mip_solver]") {
   std::string filename;
   filename = std::string(HIGHS_DIR) + "/check/instances/avgas.mps";
@@ -480,6 +908,18 @@ void solve(Highs& highs, std::string presolve,
   REQUIRE(highs.resetOptions() == HighsStatus::kOk);
 }
 
+std::unique_ptr<HighsMipSolver> runMipSolver(Highs& highs) {
+  // The MIP solver is run directly on the model of highs, so that the data
+  // of its search can be checked
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsOptions& options = highs.getOptions();
+  highs::parallel::initialize_scheduler(options.threads);
+  std::unique_ptr<HighsMipSolver> solver(
+      new HighsMipSolver(options, highs.getLp(), HighsSolution()));
+  solver->run();
+  return solver;
+}
+
 void distillationMIP(Highs& highs) {
   SpecialLps special_lps;
   HighsLp lp;
@@ -512,3 +952,45 @@ void rowlessMIP(Highs& highs) {
   solve(highs, "on", require_model_status, optimal_objective);
   solve(highs, "off", require_model_status, optimal_objective);
 }
+
+void graphColouringMIP(Highs& highs) {
+  // Colour the Groetzsch graph with as few of five identical colours as
+  // possible, so the model is symmetric with respect to permutations of
+  // the colours. The optimal number of colours is four
+  const std::vector<std::pair<HighsInt, HighsInt>> edge = {
+      {0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0},  {0, 6},  {1, 5},
+      {1, 7}, {2, 6}, {2, 8}, {3, 7}, {3, 9},  {4, 8},  {4, 5},
+      {0, 9}, {5, 10}, {6, 10}, {7, 10}, {8, 10}, {9, 10}};
+  const HighsInt num_vertex = 11;
+  const HighsInt num_colour = 5;
+  // Column vertex * num_colour + colour is one if the vertex has the
+  // colour, and column num_vertex * num_colour + colour is one if the
+  // colour is used
+  const HighsInt num_col = num_vertex * num_colour + num_colour;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    const double cost = iCol < num_vertex * num_colour ? 0 : 1;
+    REQUIRE(highs.addCol(cost, 0, 1, 0, nullptr, nullptr) ==
+            HighsStatus::kOk);
+    REQUIRE(highs.changeColIntegrality(iCol, HighsVarType::kInteger) ==
+            HighsStatus::kOk);
+  }
+  std::vector<HighsInt> index(num_colour);
+  std::vector<double> value(num_colour, 1);
+  for (HighsInt vertex = 0; vertex < num_vertex; vertex++) {
+    for (HighsInt colour = 0; colour < num_colour; colour++)
+      index[colour] = vertex * num_colour + colour;
+    REQUIRE(highs.addRow(1, 1, num_colour, index.data(), value.data()) ==
+            HighsStatus::kOk);
+  }
+  // Adjacent vertices cannot share a colour, and only used colours can
+  // be assigned
+  value = {1, 1, -1};
+  for (const auto& e : edge) {
+    for (HighsInt colour = 0; colour < num_colour; colour++) {
+      index = {e.first * num_colour + colour, e.second * num_colour + colour,
+               num_vertex * num_colour + colour};
+      REQUIRE(highs.addRow(-kHighsInf, 0, 3, index.data(), value.data()) ==
+              HighsStatus::kOk);
+    }
+  }
+}
@@ -1,5 +1,6 @@
 #include "Highs.h"
 #include "SpecialLps.h"
+#include "TestTempFile.h"
 #include "catch.hpp"
 
 const bool dev_run = false;
@@ -86,3 +87,248 @@ TEST_CASE("Presolve", "[highs_test_presolve]") {
   REQUIRE(highs.getModelStatus() == HighsModelStatus::kInfeasible);
   REQUIRE(presolved_model.isEmpty());
 }
+
+TEST_CASE("PresolveRoutineProfile", "[highs_test_presolve]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  std::string profile_file = tempFilePath("presolve_profile.json");
+  highs.setOptionValue("presolve_profile_file", profile_file);
+  highs.readModel(model_file);
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  REQUIRE(highs.getModelPresolveStatus() == HighsPresolveStatus::kReduced);
+
+  const HighsPresolveLog& presolve_log = highs.getPresolveLog();
+  REQUIRE((HighsInt)presolve_log.routine.size() == kPresolveRoutineCount);
+  REQUIRE(presolve_log.routine[kPresolveRoutineInitialRowAndColPresolve].call ==
+          1);
+  HighsInt sum_row_removed = 0;
+  HighsInt sum_col_removed = 0;
+  for (HighsInt routine_type = kPresolveRoutineMin;
+       routine_type < kPresolveRoutineCount; routine_type++) {
+    const HighsPresolveRoutineProfile& profile =
+        presolve_log.routine[routine_type];
+    REQUIRE(profile.time >= 0);
+    REQUIRE(profile.nnz_removed >= 0);
+    REQUIRE(profile.fill_in >= 0);
+    sum_row_removed += profile.row_removed;
+    sum_col_removed += profile.col_removed;
+    if (dev_run && profile.call)
+      printf("%-28s %9d %9.3f %9d %9d %9d %9d\n",
+             highs.presolveRoutineTypeToString(routine_type).c_str(),
+             (int)profile.call, profile.time, (int)profile.row_removed,
+             (int)profile.col_removed, (int)profile.nnz_removed,
+             (int)profile.fill_in);
+  }
+  const HighsLp& lp = highs.getLp();
+  const HighsLp& presolved_lp = highs.getPresolvedLp();
+  REQUIRE(sum_row_removed == lp.num_row_ - presolved_lp.num_row_);
+  REQUIRE(sum_col_removed == lp.num_col_ - presolved_lp.num_col_);
+
+  FILE* file = fopen(profile_file.c_str(), "r");
+  REQUIRE(file != nullptr);
+  fclose(file);
+  std::remove(profile_file.c_str());
+
+  // The profile is also written when presolve returns early, and the
+  // model name is escaped in the JSON
+  SpecialLps special_lps;
+  HighsLp infeasible_lp;
+  HighsModelStatus require_model_status;
+  special_lps.primalDualInfeasible1Lp(infeasible_lp, require_model_status);
+  infeasible_lp.model_name_ = "lp \"name\" with C:\\path";
+  highs.passModel(infeasible_lp);
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  REQUIRE(highs.getModelPresolveStatus() == HighsPresolveStatus::kInfeasible);
+  file = fopen(profile_file.c_str(), "r");
+  REQUIRE(file != nullptr);
+  std::string contents;
+  char buffer[256];
+  while (fgets(buffer, sizeof(buffer), file)) contents += buffer;
+  fclose(file);
+  std::remove(profile_file.c_str());
+  REQUIRE(contents.find("\"model\": \"lp \\\"name\\\" with C:\\\\path\"") !=
+          std::string::npos);
+}
+
+TEST_CASE("PresolveRoutineControl", "[highs_test_presolve]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  highs.readModel(model_file);
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  const HighsPresolveLog& presolve_log = highs.getPresolveLog();
+  REQUIRE(presolve_log.routine[kPresolveRoutineAggregator].call > 0);
+  REQUIRE(presolve_log.routine[kPresolveRoutineParallelRowsAndCols].call > 1);
+
+  // Switch off the aggregator, and only allow one call to the parallel
+  // rows and columns routine
+  highs.setOptionValue("presolve_routine_off", 1);
+  highs.setOptionValue("presolve_parallel_rows_cols_call_limit", 1);
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  REQUIRE(highs.getModelPresolveStatus() == HighsPresolveStatus::kReduced);
+  REQUIRE(presolve_log.routine[kPresolveRoutineAggregator].call == 0);
+  REQUIRE(presolve_log.routine[kPresolveRoutineParallelRowsAndCols].call == 1);
+
+  // A zero time limit for the parallel rows and columns routine prevents
+  // it from being called, but not the aggregator
+  highs.setOptionValue("presolve_routine_off", 0);
+  highs.setOptionValue("presolve_parallel_rows_cols_time_limit", 0.0);
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  REQUIRE(presolve_log.routine[kPresolveRoutineAggregator].call > 0);
+  REQUIRE(presolve_log.routine[kPresolveRoutineParallelRowsAndCols].call == 0);
+}
+
+// Balanced transportation problem, so one of the supply and demand
+// equations is dependent on the others. The column of supply i and demand
+// j is i * num_demand + j
+static void transportationLp(HighsLp& lp, const std::vector<double>& supply,
+                             const std::vector<double>& demand) {
+  const HighsInt num_supply = supply.size();
+  const HighsInt num_demand = demand.size();
+  lp.num_col_ = num_supply * num_demand;
+  lp.num_row_ = num_supply + num_demand;
+  lp.col_lower_.assign(lp.num_col_, 0);
+  lp.col_upper_.assign(lp.num_col_, kHighsInf);
+  lp.row_lower_ = supply;
+  lp.row_lower_.insert(lp.row_lower_.end(), demand.begin(), demand.end());
+  lp.row_upper_ = lp.row_lower_;
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  lp.a_matrix_.start_.push_back(0);
+  for (HighsInt i = 0; i < num_supply; i++) {
+    for (HighsInt j = 0; j < num_demand; j++) {
+      lp.col_cost_.push_back(1 + (3 * i + 7 * j) % 11);
+      lp.a_matrix_.index_.push_back(i);
+      lp.a_matrix_.index_.push_back(num_supply + j);
+      lp.a_matrix_.value_.push_back(1);
+      lp.a_matrix_.value_.push_back(1);
+      lp.a_matrix_.start_.push_back(lp.a_matrix_.index_.size());
+    }
+  }
+}
+
+TEST_CASE("PresolveDependentEquations", "[highs_test_presolve]") {
+  HighsLp lp;
+  transportationLp(lp, {20, 30, 25, 35}, {10, 40, 15, 25, 20});
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  const HighsPresolveLog& presolve_log = highs.getPresolveLog();
+  REQUIRE(presolve_log.routine[kPresolveRoutineDependentEquations]
+              .row_removed == 1);
+  REQUIRE(highs.getPresolvedLp().num_row_ == lp.num_row_ - 1);
+
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double objective_value = highs.getInfo().objective_function_value;
+  highs.clearSolver();
+  highs.setOptionValue("presolve", kHighsOffString);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    objective_value) < 1e-6);
+}
+
+TEST_CASE("PresolveDependentEquationsPeeling", "[highs_test_presolve]") {
+  // The transportation problem is extended by an equation for each supply
+  // that defines a bounded column y_i = x_i0 + 2 x_i1. Each y_i is in no
+  // other equation, so these equations are discarded as independent
+  // before the factorization, which still finds the dependent equation of
+  // the transportation problem
+  const std::vector<double> supply = {20, 30, 25, 35};
+  const std::vector<double> demand = {10, 40, 15, 25, 20};
+  const HighsInt num_supply = supply.size();
+  const HighsInt num_demand = demand.size();
+  HighsLp lp;
+  transportationLp(lp, supply, demand);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  const HighsInt y_col = highs.getNumCol();
+  for (HighsInt i = 0; i < num_supply; i++)
+    REQUIRE(highs.addCol(0.5, 0, 30, 0, nullptr, nullptr) == HighsStatus::kOk);
+  for (HighsInt i = 0; i < num_supply; i++) {
+    const HighsInt index[3] = {i * num_demand, i * num_demand + 1, y_col + i};
+    const double value[3] = {1, 2, -1};
+    REQUIRE(highs.addRow(0, 0, 3, index, value) == HighsStatus::kOk);
+  }
+  // The columns y_i share a capacity row
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+  for (HighsInt i = 0; i < num_supply; i++) {
+    index.push_back(y_col + i);
+    value.push_back(1 + i);
+  }
+  REQUIRE(highs.addRow(-kHighsInf, 200, num_supply, index.data(),
+                       value.data()) == HighsStatus::kOk);
+  const HighsInt num_row = highs.getNumRow();
+
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  const HighsPresolveLog& presolve_log = highs.getPresolveLog();
+  REQUIRE(presolve_log.routine[kPresolveRoutineDependentEquations]
+              .row_removed == 1);
+  REQUIRE(highs.getPresolvedLp().num_row_ == num_row - 1);
+
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double objective_value = highs.getInfo().objective_function_value;
+  highs.clearSolver();
+  highs.setOptionValue("presolve", kHighsOffString);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    objective_value) < 1e-6);
+}
+
+TEST_CASE("PresolveRoutineMinNnzRemovalRate", "[highs_test_presolve]") {
+  // Presolve routines are only assessed on calls that take at least a
+  // millisecond, so form a model with copies of shell on the diagonal
+  // for which each call to the parallel rows and columns routine takes
+  // several milliseconds
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/shell.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  HighsLp lp = highs.getLp();
+  lp.a_matrix_.ensureColwise();
+  const HighsInt num_copy = 20;
+  for (HighsInt copy = 1; copy < num_copy; copy++) {
+    const HighsInt num_row = highs.getNumRow();
+    std::vector<HighsInt> index = lp.a_matrix_.index_;
+    for (HighsInt& iRow : index) iRow += num_row;
+    REQUIRE(highs.addRows(lp.num_row_, lp.row_lower_.data(),
+                          lp.row_upper_.data(), 0, nullptr, nullptr,
+                          nullptr) == HighsStatus::kOk);
+    REQUIRE(highs.addCols(lp.num_col_, lp.col_cost_.data(),
+                          lp.col_lower_.data(), lp.col_upper_.data(),
+                          lp.a_matrix_.numNz(), lp.a_matrix_.start_.data(),
+                          index.data(),
+                          lp.a_matrix_.value_.data()) == HighsStatus::kOk);
+  }
+  // The time for dependent equations grows too fast with the number of
+  // copies, so switch it off
+  const HighsInt dependent_equations_bit =
+      kPresolveRoutineDependentEquations - kPresolveRoutineFirstAllowOff;
+  highs.setOptionValue("presolve_routine_off", 1 << dependent_equations_bit);
+
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  const HighsPresolveLog& presolve_log = highs.getPresolveLog();
+  REQUIRE(presolve_log.routine[kPresolveRoutineParallelRowsAndCols].call > 1);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double objective_value = highs.getInfo().objective_function_value;
+
+  // No call can remove nonzeros at an infinite rate, so each routine
+  // that can be switched off is not called again after its first
+  // assessed call, and the model is still solved
+  highs.clearSolver();
+  highs.setOptionValue("presolve_routine_min_nnz_removal_rate", kHighsInf);
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  REQUIRE(presolve_log.routine[kPresolveRoutineParallelRowsAndCols].call == 1);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    objective_value) <= 1e-8 * std::fabs(objective_value));
+}
@@ -1,13 +1,23 @@
 #include <cstdio>
+#include <cstring>
 
 #include "FilereaderLp.h"
 #include "Highs.h"
 #include "catch.hpp"
+#include "presolve/HighsQpPresolve.h"
 
 const bool dev_run = false;
 const double inf = kHighsInf;
 const double double_equal_tolerance = 1e-5;
 
+// Callback that records whether the QP presolve has reduced the model
+static void qpPresolveLogCallback(HighsLogType type, const char* message,
+                                  void* log_callback_data) {
+  if (dev_run) printf("%s", message);
+  if (std::strstr(message, "QP presolve : Reductions"))
+    *(bool*)log_callback_data = true;
+}
+
 TEST_CASE("qp-unbounded", "[qpsolver]") {
   std::string filename;
   filename = std::string(HIGHS_DIR) + "/check/instances/qpunbounded.lp";
@@ -520,3 +530,152 @@ TEST_CASE("test-semi-definite1", "[qpsolver]") {
   REQUIRE(fabs(solution.col_value[0] - 1) < double_equal_tolerance);
   REQUIRE(fabs(solution.col_value[1]) < double_equal_tolerance);
 }
+
+TEST_CASE("test-qp-presolve", "[qpsolver]") {
+  // Column 3 is fixed and appears in the Hessian and two rows, one of
+  // which then becomes empty. Column 4 has no nonzeros in the
+  // constraint matrix and only a diagonal Hessian entry
+  HighsModel model;
+  HighsLp& lp = model.lp_;
+  lp.num_col_ = 5;
+  lp.num_row_ = 3;
+  lp.col_cost_ = {-1, -2, 1, 1, -3};
+  lp.col_lower_ = {0, 0, 0, 2, 0};
+  lp.col_upper_ = {10, 10, 10, 2, inf};
+  lp.row_lower_ = {1, -inf, 0};
+  lp.row_upper_ = {inf, 5, 3};
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  lp.a_matrix_.start_ = {0, 1, 2, 4, 6, 6};
+  lp.a_matrix_.index_ = {0, 0, 0, 1, 1, 2};
+  lp.a_matrix_.value_ = {1, 1, 1, 1, 1, 1};
+  HighsHessian& hessian = model.hessian_;
+  hessian.dim_ = lp.num_col_;
+  hessian.format_ = HessianFormat::kTriangular;
+  hessian.start_ = {0, 3, 5, 6, 7, 8};
+  hessian.index_ = {0, 1, 3, 1, 3, 2, 3, 4};
+  hessian.value_ = {2, -1, 0.5, 2, 1, 1, 1, 2};
+
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  const HighsInfo& info = highs.getInfo();
+  const HighsSolution& solution = highs.getSolution();
+  REQUIRE(highs.passModel(model) == HighsStatus::kOk);
+  highs.setOptionValue("presolve", "off");
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double objective_function_value = info.objective_function_value;
+  const HighsSolution no_presolve_solution = solution;
+
+  // The QP is presolved with the default presolve option. The log
+  // callback is only called when there is output
+  highs.resetOptions();
+  REQUIRE(highs.getOptions().presolve == kHighsChooseString);
+  bool qp_presolve_reduced = false;
+  highs.setLogCallback(qpPresolveLogCallback, &qp_presolve_reduced);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(qp_presolve_reduced);
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(fabs(info.objective_function_value - objective_function_value) <
+          double_equal_tolerance);
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+    REQUIRE(fabs(solution.col_value[iCol] -
+                 no_presolve_solution.col_value[iCol]) <
+            double_equal_tolerance);
+
+  for (HighsInt k = 0; k < 2; k++) {
+    if (k == 1) {
+      // Maximize the negated objective
+      for (double& cost : lp.col_cost_) cost = -cost;
+      for (double& value : hessian.value_) value = -value;
+      lp.sense_ = ObjSense::kMaximize;
+      REQUIRE(highs.passModel(model) == HighsStatus::kOk);
+    }
+    highs.setOptionValue("presolve", "on");
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    const double sign = k == 0 ? 1 : -1;
+    REQUIRE(fabs(info.objective_function_value -
+                 sign * objective_function_value) < double_equal_tolerance);
+    REQUIRE(info.max_dual_infeasibility < double_equal_tolerance);
+    REQUIRE(info.max_primal_infeasibility < double_equal_tolerance);
+    for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+      REQUIRE(fabs(solution.col_value[iCol] -
+                   no_presolve_solution.col_value[iCol]) <
+              double_equal_tolerance);
+      REQUIRE(fabs(solution.col_dual[iCol] -
+                   sign * no_presolve_solution.col_dual[iCol]) <
+              double_equal_tolerance);
+    }
+    REQUIRE(fabs(solution.col_value[4] - 1.5) < double_equal_tolerance);
+  }
+}
+
+TEST_CASE("test-qp-presolve-substitution", "[qpsolver]") {
+  // Column 3 is free and a singleton in the equation row 0, so is
+  // substituted out, filling in the Hessian. Row 1 is then a doubleton
+  // equation, in which column 4 is substituted out, moving its Hessian
+  // entries, its bounds and its entry in row 2 to column 1
+  HighsModel model;
+  HighsLp& lp = model.lp_;
+  lp.num_col_ = 5;
+  lp.num_row_ = 3;
+  lp.col_cost_ = {-1, -2, 1, 1, -3};
+  lp.col_lower_ = {0, 0, 0, -inf, 0};
+  lp.col_upper_ = {10, 10, 10, inf, 1};
+  lp.row_lower_ = {4, 1, -inf};
+  lp.row_upper_ = {4, 1, 3};
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  lp.a_matrix_.start_ = {0, 2, 4, 5, 6, 8};
+  lp.a_matrix_.index_ = {0, 2, 0, 1, 0, 0, 1, 2};
+  lp.a_matrix_.value_ = {1, 1, 1, 1, 1, 1, -2, 1};
+  HighsHessian& hessian = model.hessian_;
+  hessian.dim_ = lp.num_col_;
+  hessian.format_ = HessianFormat::kTriangular;
+  hessian.start_ = {0, 2, 4, 5, 6, 7};
+  hessian.index_ = {0, 1, 1, 4, 2, 3, 4};
+  hessian.value_ = {2, -1, 2, 0.5, 2, 1, 1};
+
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  HighsModel reduced_model;
+  HighsQpPostsolveRecord record;
+  REQUIRE(presolveQp(highs.getOptions(), model, reduced_model, record) ==
+          HighsPresolveStatus::kReduced);
+  REQUIRE(record.num_removed_col == 2);
+  REQUIRE(record.num_removed_row == 2);
+  REQUIRE(record.reductions.size() == 2);
+  REQUIRE(record.reductions[0].type ==
+          HighsQpReductionType::kFreeColSingleton);
+  REQUIRE(record.reductions[1].type ==
+          HighsQpReductionType::kDoubletonEquation);
+
+  const HighsInfo& info = highs.getInfo();
+  const HighsSolution& solution = highs.getSolution();
+  REQUIRE(highs.passModel(model) == HighsStatus::kOk);
+  highs.setOptionValue("presolve", "off");
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double objective_function_value = info.objective_function_value;
+  const HighsSolution no_presolve_solution = solution;
+
+  highs.setOptionValue("presolve", "choose");
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(fabs(info.objective_function_value - objective_function_value) <
+          double_equal_tolerance);
+  REQUIRE(info.max_dual_infeasibility < double_equal_tolerance);
+  REQUIRE(info.max_primal_infeasibility < double_equal_tolerance);
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    REQUIRE(fabs(solution.col_value[iCol] -
+                 no_presolve_solution.col_value[iCol]) <
+            double_equal_tolerance);
+    REQUIRE(fabs(solution.col_dual[iCol] -
+                 no_presolve_solution.col_dual[iCol]) <
+            double_equal_tolerance);
+  }
+  for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++)
+    REQUIRE(fabs(solution.row_dual[iRow] -
+                 no_presolve_solution.row_dual[iRow]) <
+            double_equal_tolerance);
+}
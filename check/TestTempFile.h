@@ -0,0 +1,30 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file TestTempFile.h
+ * @brief Path of a file written by a test in the temporary directory
+ */
+#ifndef TEST_TEMPFILE_H_
+#define TEST_TEMPFILE_H_
+
+#include <cstdlib>
+#include <string>
+
+// Returns the path of the file with the given name in the temporary
+// directory given by TMPDIR, TMP or TEMP, or /tmp if none is set, so
+// that tests do not write files into the current working directory
+inline std::string tempFilePath(const std::string& name) {
+  for (const char* variable : {"TMPDIR", "TMP", "TEMP"}) {
+    const char* dir = std::getenv(variable);
+    if (dir != nullptr && *dir != '\0') return std::string(dir) + "/" + name;
+  }
+  return "/tmp/" + name;
+}
+
+#endif /* TEST_TEMPFILE_H_ */
@@ -0,0 +1,126 @@
+NAME        restart_mip
+ROWS
+ N  Obj     
+ L  r0      
+ L  r1      
+ L  r2      
+ L  r3      
+ L  r4      
+ L  r5      
+ L  r6      
+ L  r7      
+COLUMNS
+    MARK0000  'MARKER'                 'INTORG'
+    c0        Obj       -11
+    c1        Obj       -8
+    c1        r0        -19
+    c1        r1        5
+    c1        r5        24
+    c1        r6        26
+    c2        Obj       -12
+    c2        r5        -17
+    c2        r7        -14
+    c3        Obj       -32
+    c3        r3        -5
+    c3        r4        7
+    c3        r5        17
+    c3        r6        11
+    c4        Obj       -40
+    c4        r0        30
+    c4        r2        11
+    c4        r4        -10
+    c4        r5        -14
+    c4        r7        29
+    c5        Obj       -15
+    c5        r0        6
+    c5        r1        -4
+    c5        r3        -18
+    c5        r6        23
+    c6        Obj       -16
+    c6        r1        11
+    c6        r2        29
+    c6        r5        30
+    c7        Obj       -6
+    c7        r1        -10
+    c7        r5        -5
+    c8        Obj       -9
+    c8        r1        25
+    c8        r4        18
+    c8        r7        -23
+    c9        Obj       -7
+    c9        r1        -21
+    c9        r6        1
+    c10       Obj       -39
+    c10       r2        16
+    c10       r3        -19
+    c10       r4        24
+    c10       r7        -12
+    c11       Obj       -29
+    c11       r2        16
+    c11       r7        6
+    c12       Obj       -18
+    c12       r0        16
+    c12       r1        25
+    c12       r2        14
+    c12       r4        24
+    c12       r7        25
+    c13       Obj       -40
+    c13       r0        30
+    c13       r1        6
+    c13       r3        16
+    c13       r4        10
+    c13       r6        -7
+    c14       Obj       -35
+    c14       r3        4
+    c14       r5        25
+    c14       r7        11
+    MARK0001  'MARKER'                 'INTEND'
+    c15       Obj       -8
+    c15       r1        8
+    c15       r3        14
+    c15       r4        11
+    c15       r6        -17
+    c15       r7        -15
+    c16       Obj       -10
+    c16       r0        -15.91
+    c16       r3        9.99
+    c16       r5        14.06
+    c17       Obj       -1
+    c17       r2        -10.36
+    c17       r4        19.24
+    c17       r7        20.72
+RHS
+    RHS_V     r0        64
+    RHS_V     r1        60
+    RHS_V     r2        109
+    RHS_V     r3        85
+    RHS_V     r4        125
+    RHS_V     r5        201
+    RHS_V     r6        131
+    RHS_V     r7        77
+BOUNDS
+ UI BOUND     c0        10
+ UI BOUND     c1        10
+ UI BOUND     c2        3
+ LI BOUND     c3        -10
+ UI BOUND     c3        -1
+ UI BOUND     c4        5
+ UI BOUND     c5        3
+ UI BOUND     c6        7
+ LI BOUND     c7        -9
+ UI BOUND     c7        2
+ UI BOUND     c8        10
+ UI BOUND     c9        3
+ UI BOUND     c10       9
+ LI BOUND     c11       -5
+ UI BOUND     c11       -2
+ UI BOUND     c12       5
+ UI BOUND     c13       4
+ UI BOUND     c14       11
+ LO BOUND     c15       -6
+ UP BOUND     c15       3.5
+ LO BOUND     c16       -12
+ UP BOUND     c16       1.5
+ LO BOUND     c17       -11
+ UP BOUND     c17       3
+ENDATA
@@ -21,6 +21,8 @@
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsRanging.h"
 #include "lp_data/HighsSolutionDebug.h"
+#include "mip/HighsMipCheckpoint.h"
+#include "mip/HighsMipSolutionPool.h"
 #include "model/HighsModel.h"
 #include "presolve/ICrash.h"
 #include "presolve/PresolveComponent.h"
@@ -122,6 +124,14 @@ class Highs {
    */
   HighsStatus readBasis(const std::string& filename);
 
+  /**
+   * @brief Read in a MIP checkpoint, from which the next solve of the same
+   * model resumes the branch-and-bound search. The checkpoint is discarded
+   * by that solve unless mip_keep_checkpoint is set, and by clearSolver or
+   * any change to the model
+   */
+  HighsStatus readMipCheckpoint(const std::string& filename);
+
   /**
    * @brief Presolve the incumbent model
    */
@@ -297,6 +307,21 @@ class Highs {
    */
   const HighsSolution& getSolution() const { return solution_; }
 
+  /**
+   * @brief Return a const reference to the best distinct feasible
+   * solutions of the last MIP solve, in the order of increasing
+   * objective value for minimization and decreasing objective value
+   * for maximization. The pool holds up to mip_solution_pool_size
+   * solutions, and solutions are distinct if they differ in the value
+   * of an integer variable. The search only prunes nodes that cannot
+   * contain a solution better than the worst one in a full pool, so
+   * if the MIP is solved to optimality these are the best solutions
+   * within the MIP gap tolerances
+   */
+  const std::vector<HighsMipPoolSolution>& getMipSolutionPool() const {
+    return mip_solution_pool_;
+  }
+
   const ICrashInfo& getICrashInfo() const { return icrash_info_; };
 
   /**
@@ -596,6 +621,13 @@ class Highs {
    */
   HighsStatus writeBasis(const std::string& filename);
 
+  /**
+   * @brief Write out the state of the last MIP solve to a file, which is
+   * only possible if mip_keep_checkpoint is set and the branch-and-bound
+   * search stopped on a limit with open nodes
+   */
+  HighsStatus writeMipCheckpoint(const std::string& filename);
+
   /**
    * Methods for incumbent model modification
    */
@@ -907,6 +939,8 @@ class Highs {
   std::string basisStatusToString(const HighsBasisStatus basis_status) const;
   std::string basisValidityToString(const HighsInt basis_validity) const;
   std::string presolveRuleTypeToString(const HighsInt presolve_rule) const;
+  std::string presolveRoutineTypeToString(
+      const HighsInt presolve_routine) const;
 
   /**
    * @brief Releases all resources held by the global scheduler instance. It is
@@ -1086,6 +1120,8 @@ class Highs {
   HighsSolution solution_;
   HighsBasis basis_;
   ICrashInfo icrash_info_;
+  HighsMipCheckpoint mip_checkpoint_;
+  std::vector<HighsMipPoolSolution> mip_solution_pool_;
 
   HighsModel model_;
   HighsModel presolved_model_;
@@ -1120,6 +1156,7 @@ class Highs {
 
   HighsStatus callSolveLp(HighsLp& lp, const string message);
   HighsStatus callSolveQp();
+  HighsStatus callQuass(const HighsModel& model, HighsSolution& solution);
   HighsStatus callSolveMip();
   HighsStatus callRunPostsolve(const HighsSolution& solution,
                                const HighsBasis& basis);
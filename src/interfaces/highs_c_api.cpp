@@ -414,6 +414,29 @@ double Highs_getObjectiveValue(const void* highs) {
   return ((Highs*)highs)->getObjectiveValue();
 }
 
+HighsInt Highs_getNumMipPoolSolutions(const void* highs) {
+  return ((Highs*)highs)->getMipSolutionPool().size();
+}
+
+HighsInt Highs_getMipPoolSolution(const void* highs, const HighsInt index,
+                                  double* objective_function_value,
+                                  double* col_value) {
+  const std::vector<HighsMipPoolSolution>& pool =
+      ((Highs*)highs)->getMipSolutionPool();
+  if (index < 0 || index >= (HighsInt)pool.size())
+    return (HighsInt)HighsStatus::kError;
+
+  if (objective_function_value != nullptr)
+    *objective_function_value = pool[index].objective;
+
+  if (col_value != nullptr) {
+    for (HighsInt i = 0; i < (HighsInt)pool[index].col_value.size(); i++)
+      col_value[i] = pool[index].col_value[i];
+  }
+
+  return (HighsInt)HighsStatus::kOk;
+}
+
 HighsInt Highs_getBasicVariables(const void* highs, HighsInt* basic_variables) {
   return (HighsInt)((Highs*)highs)->getBasicVariables(basic_variables);
 }
@@ -676,6 +676,35 @@ HighsInt Highs_getPrimalRay(const void* highs, HighsInt* has_primal_ray,
  */
 double Highs_getObjectiveValue(const void* highs);
 
+/**
+ * Return the number of solutions in the MIP solution pool, which holds up to
+ * `mip_solution_pool_size` of the best distinct feasible solutions found by the
+ * last MIP solve.
+ *
+ * @param highs     a pointer to the Highs instance
+ *
+ * @returns the number of solutions in the MIP solution pool
+ */
+HighsInt Highs_getNumMipPoolSolutions(const void* highs);
+
+/**
+ * Get a solution from the MIP solution pool. The solutions are ordered from
+ * the best to the worst objective function value.
+ *
+ * @param highs                     a pointer to the Highs instance
+ * @param index                     the index of the solution, from 0 to one
+ *                                  less than the number of pool solutions
+ * @param objective_function_value  the objective function value of the
+ *                                  solution
+ * @param col_value                 array of length [num_col], filled with
+ *                                  primal column values
+ *
+ * @returns a `kHighsStatus` constant indicating whether the call succeeded
+ */
+HighsInt Highs_getMipPoolSolution(const void* highs, const HighsInt index,
+                                  double* objective_function_value,
+                                  double* col_value);
+
 /**
  * Get the indices of the rows and columns that make up the basis matrix of a
  * basic feasible solution.
@@ -215,6 +215,33 @@ enum PresolveRuleType : int {
   kPresolveRuleCount,
 };
 
+// Presolve routines called from the main presolve loop, whose cost is
+// profiled
+enum PresolveRoutineType : int {
+  kPresolveRoutineIllegal = -1,
+  kPresolveRoutineMin = 0,
+  kPresolveRoutineInitialRowAndColPresolve = kPresolveRoutineMin,
+  kPresolveRoutineRowSingletons,
+  kPresolveRoutineChangedRows,
+  kPresolveRoutineDoubletonEquations,
+  kPresolveRoutineColSingletons,
+  kPresolveRoutineChangedCols,
+  kPresolveRoutineConflictGraphSubstitutions,
+  kPresolveRoutineStrengthenInequalities,
+  kPresolveRoutineDependentFreeCols,
+  // The remaining routines can be switched off or given a budget
+  kPresolveRoutineFirstAllowOff,
+  kPresolveRoutineAggregator = kPresolveRoutineFirstAllowOff,
+  kPresolveRoutineSparsify,
+  kPresolveRoutineParallelRowsAndCols,
+  kPresolveRoutineDominatedColumns,
+  kPresolveRoutineProbing,
+  kPresolveRoutineDependentEquations,
+  kPresolveRoutineMax = kPresolveRoutineDependentEquations,
+  kPresolveRoutineLastAllowOff = kPresolveRoutineMax,
+  kPresolveRoutineCount,
+};
+
 // Default and max allowed power-of-two matrix scale factor
 const HighsInt kDefaultAllowedMatrixPow2Scale = 20;
 const HighsInt kMaxAllowedMatrixPow2Scale = 30;
@@ -90,8 +90,18 @@ struct HighsPresolveRuleLog {
   HighsInt row_removed;
 };
 
+struct HighsPresolveRoutineProfile {
+  HighsInt call;
+  double time;
+  HighsInt row_removed;
+  HighsInt col_removed;
+  HighsInt nnz_removed;
+  HighsInt fill_in;
+};
+
 struct HighsPresolveLog {
   std::vector<HighsPresolveRuleLog> rule;
+  std::vector<HighsPresolveRoutineProfile> routine;
   void clear();
 };
 
@@ -27,8 +27,10 @@
 #include "lp_data/HighsLpSolverObject.h"
 #include "lp_data/HighsSolve.h"
 #include "mip/HighsMipSolver.h"
+#include "mip/HighsMipSolverData.h"
 #include "model/HighsHessianUtils.h"
 #include "parallel/HighsParallel.h"
+#include "presolve/HighsQpPresolve.h"
 #include "presolve/ICrashX.h"
 #include "qpsolver/quass.hpp"
 #include "simplex/HSimplex.h"
@@ -52,6 +54,7 @@ HighsStatus Highs::clearSolver() {
   HighsStatus return_status = HighsStatus::kOk;
   clearPresolve();
   invalidateUserSolverData();
+  mip_checkpoint_.clear();
   return returnFromHighs(return_status);
 }
 
@@ -549,6 +552,19 @@ HighsStatus Highs::readBasis(const std::string& filename) {
   return HighsStatus::kOk;
 }
 
+HighsStatus Highs::readMipCheckpoint(const std::string& filename) {
+  HighsStatus return_status = HighsStatus::kOk;
+  HighsMipCheckpoint read_checkpoint;
+  return_status = interpretCallStatus(
+      options_.log_options,
+      readMipCheckpointFile(options_.log_options, read_checkpoint, filename),
+      return_status, "readMipCheckpoint");
+  if (return_status != HighsStatus::kOk) return return_status;
+  // Whether the checkpoint belongs to the model is checked by the MIP solver
+  mip_checkpoint_ = std::move(read_checkpoint);
+  return HighsStatus::kOk;
+}
+
 HighsStatus Highs::writeModel(const std::string& filename) {
   HighsStatus return_status = HighsStatus::kOk;
 
@@ -589,6 +605,17 @@ HighsStatus Highs::writeBasis(const std::string& filename) {
   return returnFromHighs(return_status);
 }
 
+HighsStatus Highs::writeMipCheckpoint(const std::string& filename) {
+  if (!mip_checkpoint_.valid) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "writeMipCheckpoint: no MIP search has stopped with open "
+                 "nodes\n");
+    return HighsStatus::kError;
+  }
+  return writeMipCheckpointFile(options_.log_options, mip_checkpoint_,
+                                filename);
+}
+
 HighsStatus Highs::presolve() {
   HighsStatus return_status = HighsStatus::kOk;
 
@@ -2493,6 +2520,11 @@ std::string Highs::presolveRuleTypeToString(
   return utilPresolveRuleTypeToString(presolve_rule);
 }
 
+std::string Highs::presolveRoutineTypeToString(
+    const HighsInt presolve_routine) const {
+  return utilPresolveRoutineTypeToString(presolve_routine);
+}
+
 // Private methods
 void Highs::deprecationMessage(const std::string& method_name,
                                const std::string& alt_method_name) const {
@@ -2644,6 +2676,8 @@ void Highs::invalidateModelStatusSolutionAndInfo() {
   invalidateModelStatus();
   invalidateSolution();
   invalidateInfo();
+  // the search of a MIP checkpoint is not valid for a modified model
+  mip_checkpoint_.clear();
 }
 
 void Highs::invalidateModelStatus() {
@@ -2660,6 +2694,7 @@ void Highs::invalidateSolution() {
   info_.max_dual_infeasibility = kHighsIllegalInfeasibilityMeasure;
   info_.sum_dual_infeasibilities = kHighsIllegalInfeasibilityMeasure;
   this->solution_.invalidate();
+  mip_solution_pool_.clear();
 }
 
 void Highs::invalidateBasis() {
@@ -2711,6 +2746,51 @@ HighsStatus Highs::callSolveQp() {
     return HighsStatus::kError;
   }
   //
+  // Presolve the QP unless presolve is switched off
+  HighsModel reduced_model;
+  HighsQpPostsolveRecord qp_postsolve_record;
+  HighsPresolveStatus qp_presolve_status = HighsPresolveStatus::kNotPresolved;
+  if (options_.presolve != kHighsOffString)
+    qp_presolve_status =
+        presolveQp(options_, model_, reduced_model, qp_postsolve_record);
+  if (qp_presolve_status == HighsPresolveStatus::kInfeasible) {
+    highsLogUser(options_.log_options, HighsLogType::kInfo,
+                 "QP presolve : Infeasible\n");
+    model_status_ = HighsModelStatus::kInfeasible;
+    solution_.value_valid = false;
+    solution_.dual_valid = false;
+    return HighsStatus::kOk;
+  }
+  HighsStatus return_status = HighsStatus::kOk;
+  if (qp_presolve_status == HighsPresolveStatus::kReducedToEmpty) {
+    // All columns have been removed, so the reduced QP is solved
+    HighsSolution reduced_solution;
+    reduced_solution.value_valid = true;
+    reduced_solution.dual_valid = true;
+    model_status_ = HighsModelStatus::kOptimal;
+    postsolveQp(model_, qp_postsolve_record, reduced_solution, solution_);
+  } else if (qp_presolve_status == HighsPresolveStatus::kReduced) {
+    HighsSolution reduced_solution;
+    return_status = callQuass(reduced_model, reduced_solution);
+    if (return_status == HighsStatus::kError) return return_status;
+    postsolveQp(model_, qp_postsolve_record, reduced_solution, solution_);
+  } else {
+    return_status = callQuass(model_, solution_);
+    if (return_status == HighsStatus::kError) return return_status;
+  }
+  // Get the objective and any KKT failures
+  info_.objective_function_value = model_.objectiveValue(solution_.col_value);
+  getKktFailures(options_, model_, solution_, basis_, info_);
+  info_.valid = true;
+  if (model_status_ == HighsModelStatus::kOptimal)
+    checkOptimality("QP", return_status);
+  return return_status;
+}
+
+HighsStatus Highs::callQuass(const HighsModel& model, HighsSolution& solution) {
+  const HighsLp& lp = model.lp_;
+  const HighsHessian& hessian = model.hessian_;
+  //
   // Run the QP solver
   Instance instance(lp.num_col_, lp.num_row_);
 
@@ -2787,33 +2867,27 @@ HighsStatus Highs::callSolveQp() {
                   : runtime.status == ProblemStatus::TIMELIMIT
                       ? HighsModelStatus::kTimeLimit
                       : HighsModelStatus::kNotset;
-  solution_.col_value.resize(lp.num_col_);
-  solution_.col_dual.resize(lp.num_col_);
+  solution.col_value.resize(lp.num_col_);
+  solution.col_dual.resize(lp.num_col_);
   const double objective_multiplier = lp.sense_ == ObjSense::kMinimize ? 1 : -1;
   for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
-    solution_.col_value[iCol] = runtime.primal.value[iCol];
-    solution_.col_dual[iCol] =
+    solution.col_value[iCol] = runtime.primal.value[iCol];
+    solution.col_dual[iCol] =
         objective_multiplier * runtime.dualvar.value[iCol];
   }
-  solution_.row_value.resize(lp.num_row_);
-  solution_.row_dual.resize(lp.num_row_);
+  solution.row_value.resize(lp.num_row_);
+  solution.row_dual.resize(lp.num_row_);
   // Negate the vector and Hessian
   for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
-    solution_.row_value[iRow] = runtime.rowactivity.value[iRow];
-    solution_.row_dual[iRow] =
+    solution.row_value[iRow] = runtime.rowactivity.value[iRow];
+    solution.row_dual[iRow] =
         objective_multiplier * runtime.dualcon.value[iRow];
   }
-  solution_.value_valid = true;
-  solution_.dual_valid = true;
-  // Get the objective and any KKT failures
-  info_.objective_function_value = model_.objectiveValue(solution_.col_value);
-  getKktFailures(options_, model_, solution_, basis_, info_);
+  solution.value_valid = true;
+  solution.dual_valid = true;
   // Set the QP-specific values of info_
   info_.simplex_iteration_count += runtime.statistics.phase1_iterations;
   info_.qp_iteration_count += runtime.statistics.num_iterations;
-  info_.valid = true;
-  if (model_status_ == HighsModelStatus::kOptimal)
-    checkOptimality("QP", return_status);
   return return_status;
 }
 
@@ -2850,7 +2924,19 @@ HighsStatus Highs::callSolveMip() {
                                   options_.primal_feasibility_tolerance);
   }
   HighsLp& lp = has_semi_variables ? use_lp : model_.lp_;
-  HighsMipSolver solver(options_, lp, solution_);
+  // Presolve and symmetry handling remove feasible solutions that are
+  // not optimal, so they are switched off when the MIP solver keeps a
+  // pool of the best solutions
+  const bool use_pool_options = options_.mip_solution_pool_size > 0;
+  HighsOptions pool_options;
+  if (use_pool_options) {
+    pool_options = options_;
+    pool_options.presolve = kHighsOffString;
+    pool_options.mip_detect_symmetry = false;
+  }
+  HighsMipSolver solver(use_pool_options ? pool_options : options_, lp,
+                        solution_);
+  solver.checkpoint = &mip_checkpoint_;
   solver.run();
   options_.log_dev_level = log_dev_level;
   // Set the return_status, model status and, for completeness, scaled
@@ -2874,6 +2960,11 @@ HighsStatus Highs::callSolveMip() {
     // There is no primal solution: should be so by default
     assert(!solution_.value_valid);
   }
+  // Extract the solution pool, restricting the solutions to the
+  // columns of the original model if it has semi-variables
+  mip_solution_pool_ = solver.solutionPool.getSolutions();
+  for (HighsMipPoolSolution& pool_solution : mip_solution_pool_)
+    pool_solution.col_value.resize(model_.lp_.num_col_);
   // Check that no modified upper bounds for semi-variables are active
   if (solution_.value_valid &&
       activeModifiedUpperBounds(options_, model_.lp_, solution_.col_value)) {
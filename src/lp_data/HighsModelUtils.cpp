@@ -1243,6 +1243,42 @@ std::string utilPresolveRuleTypeToString(const HighsInt rule_type) {
   return "????";
 }
 
+std::string utilPresolveRoutineTypeToString(const HighsInt routine_type) {
+  if (routine_type == kPresolveRoutineInitialRowAndColPresolve) {
+    return "Initial row and col presolve";
+  } else if (routine_type == kPresolveRoutineRowSingletons) {
+    return "Row singletons";
+  } else if (routine_type == kPresolveRoutineChangedRows) {
+    return "Changed rows";
+  } else if (routine_type == kPresolveRoutineDoubletonEquations) {
+    return "Doubleton equations";
+  } else if (routine_type == kPresolveRoutineColSingletons) {
+    return "Column singletons";
+  } else if (routine_type == kPresolveRoutineChangedCols) {
+    return "Changed columns";
+  } else if (routine_type == kPresolveRoutineConflictGraphSubstitutions) {
+    return "Conflict graph substitutions";
+  } else if (routine_type == kPresolveRoutineAggregator) {
+    return "Aggregator";
+  } else if (routine_type == kPresolveRoutineSparsify) {
+    return "Sparsify";
+  } else if (routine_type == kPresolveRoutineParallelRowsAndCols) {
+    return "Parallel rows and columns";
+  } else if (routine_type == kPresolveRoutineStrengthenInequalities) {
+    return "Strengthen inequalities";
+  } else if (routine_type == kPresolveRoutineDominatedColumns) {
+    return "Dominated columns";
+  } else if (routine_type == kPresolveRoutineProbing) {
+    return "Probing";
+  } else if (routine_type == kPresolveRoutineDependentEquations) {
+    return "Dependent equations";
+  } else if (routine_type == kPresolveRoutineDependentFreeCols) {
+    return "Dependent free columns";
+  }
+  assert(1 == 0);
+  return "????";
+}
+
 // Deduce the HighsStatus value corresponding to a HighsModelStatus value.
 HighsStatus highsStatusFromHighsModelStatus(HighsModelStatus model_status) {
   switch (model_status) {
@@ -327,6 +327,21 @@ struct HighsOptionsStruct {
   HighsInt presolve_substitution_maxfillin;
   HighsInt presolve_rule_off;
   bool presolve_rule_logging;
+  std::string presolve_profile_file;
+  HighsInt presolve_routine_off;
+  double presolve_aggregator_time_limit;
+  HighsInt presolve_aggregator_call_limit;
+  double presolve_sparsify_time_limit;
+  HighsInt presolve_sparsify_call_limit;
+  double presolve_parallel_rows_cols_time_limit;
+  HighsInt presolve_parallel_rows_cols_call_limit;
+  double presolve_dominated_cols_time_limit;
+  HighsInt presolve_dominated_cols_call_limit;
+  double presolve_probing_time_limit;
+  HighsInt presolve_probing_call_limit;
+  double presolve_dependent_equations_time_limit;
+  HighsInt presolve_dependent_equations_call_limit;
+  double presolve_routine_min_nnz_removal_rate;
   bool simplex_initial_condition_check;
   bool no_unnecessary_rebuild_refactor;
   double simplex_initial_condition_tolerance;
@@ -356,13 +371,22 @@ struct HighsOptionsStruct {
 
   // Options for MIP solver
   bool mip_detect_symmetry;
+  HighsInt mip_symmetry_max_nodes;
   HighsInt mip_max_nodes;
   HighsInt mip_max_stall_nodes;
+  HighsInt mip_root_racers;
+  bool mip_parallel_separation;
+  bool mip_background_heuristics;
+  bool mip_improvement_heuristics;
+  bool mip_deterministic;
+  bool mip_conflict_first_uip;
   HighsInt mip_max_leaves;
   HighsInt mip_max_improving_sols;
   HighsInt mip_lp_age_limit;
   HighsInt mip_pool_age_limit;
   HighsInt mip_pool_soft_limit;
+  HighsInt mip_solution_pool_size;
+  bool mip_keep_checkpoint;
   HighsInt mip_pscost_minreliable;
   HighsInt mip_min_cliquetable_entries_for_parallelism;
   HighsInt mip_report_level;
@@ -370,6 +394,9 @@ struct HighsOptionsStruct {
   double mip_rel_gap;
   double mip_abs_gap;
   double mip_heuristic_effort;
+  double mip_node_memory_limit;
+  double mip_work_limit;
+  std::string mip_trace_file;
 #ifdef HIGHS_DEBUGSOL
   std::string mip_debug_solution_file;
 #endif
@@ -710,6 +737,12 @@ class HighsOptions : public HighsOptionsStruct {
                                        advanced, &mip_detect_symmetry, true);
     records.push_back(record_bool);
 
+    record_int = new OptionRecordInt(
+        "mip_symmetry_max_nodes",
+        "Max number of nodes in the search tree of symmetry detection",
+        advanced, &mip_symmetry_max_nodes, 1, kHighsIInf, kHighsIInf);
+    records.push_back(record_int);
+
     record_int = new OptionRecordInt("mip_max_nodes",
                                      "MIP solver max number of nodes", advanced,
                                      &mip_max_nodes, 0, kHighsIInf, kHighsIInf);
@@ -720,6 +753,56 @@ class HighsOptions : public HighsOptionsStruct {
         "MIP solver max number of nodes where estimate is above cutoff bound",
         advanced, &mip_max_stall_nodes, 0, kHighsIInf, kHighsIInf);
     records.push_back(record_int);
+
+    record_int = new OptionRecordInt(
+        "mip_root_racers",
+        "Number of root node evaluations of the MIP solver that race with "
+        "different random seeds: 1 => no racing",
+        advanced, &mip_root_racers, 1, 1, kHighsIInf);
+    records.push_back(record_int);
+
+    record_bool = new OptionRecordBool(
+        "mip_parallel_separation",
+        "Whether the cut separators of a separation round run concurrently",
+        advanced, &mip_parallel_separation, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_background_heuristics",
+        "Whether the sub-MIPs of the RENS and RINS heuristics run as background "
+        "tasks during the tree search",
+        advanced, &mip_background_heuristics, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_improvement_heuristics",
+        "Whether local branching and proximity search are used to improve "
+        "the incumbent during the tree search",
+        advanced, &mip_improvement_heuristics, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_deterministic",
+        "Whether the parallel components of the MIP solver synchronise on "
+        "work unit boundaries, so that the search is reproducible for a fixed "
+        "number of threads",
+        advanced, &mip_deterministic, true);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_conflict_first_uip",
+        "Whether conflict analysis only learns the first UIP conflict of the "
+        "deepest non-empty depth level instead of conflicts and reconvergence "
+        "cuts of up to five depth levels",
+        advanced, &mip_conflict_first_uip, false);
+    records.push_back(record_bool);
+
+    record_double = new OptionRecordDouble(
+        "mip_work_limit",
+        "Limit on the work units of the MIP solver, where one work unit "
+        "corresponds to one simplex iteration",
+        advanced, &mip_work_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
 #ifdef HIGHS_DEBUGSOL
     record_string = new OptionRecordString(
         "mip_debug_solution_file",
@@ -728,6 +811,13 @@ class HighsOptions : public HighsOptionsStruct {
     records.push_back(record_string);
 #endif
 
+    record_string = new OptionRecordString(
+        "mip_trace_file",
+        "File to which the MIP solver writes a CSV record for each node of "
+        "the branch-and-bound search",
+        advanced, &mip_trace_file, kHighsFilenameDefault);
+    records.push_back(record_string);
+
     record_int = new OptionRecordInt(
         "mip_max_leaves", "MIP solver max number of leave nodes", advanced,
         &mip_max_leaves, 0, kHighsIInf, kHighsIInf);
@@ -760,6 +850,21 @@ class HighsOptions : public HighsOptionsStruct {
                                      kHighsIInf);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "mip_solution_pool_size",
+        "Number of best distinct feasible solutions that the MIP solver keeps "
+        "in its solution pool: a positive value switches off presolve and "
+        "symmetry detection for the MIP solver",
+        advanced, &mip_solution_pool_size, 0, 0, kHighsIInf);
+    records.push_back(record_int);
+
+    record_bool = new OptionRecordBool(
+        "mip_keep_checkpoint",
+        "Whether a MIP solve that stops on a limit with open nodes keeps a "
+        "checkpoint of its search, from which the next solve resumes",
+        advanced, &mip_keep_checkpoint, false);
+    records.push_back(record_bool);
+
     record_int = new OptionRecordInt("mip_pscost_minreliable",
                                      "minimal number of observations before "
                                      "pseudo costs are considered reliable",
@@ -790,6 +895,13 @@ class HighsOptions : public HighsOptionsStruct {
         &mip_heuristic_effort, 0.0, 0.05, 1.0);
     records.push_back(record_double);
 
+    record_double = new OptionRecordDouble(
+        "mip_node_memory_limit",
+        "Memory limit in MB for the open nodes of the MIP solver, beyond which "
+        "the least promising open nodes are written to a temporary file",
+        advanced, &mip_node_memory_limit, 0.0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
     record_double = new OptionRecordDouble(
         "mip_rel_gap",
         "tolerance on relative gap, |ub-lb|/|ub|, to determine whether "
@@ -984,6 +1096,95 @@ class HighsOptions : public HighsOptionsStruct {
         advanced, &presolve_rule_logging, true);
     records.push_back(record_bool);
 
+    record_string = new OptionRecordString(
+        "presolve_profile_file",
+        "File for a JSON profile of the presolve routines: \"\" => no file",
+        advanced, &presolve_profile_file, "");
+    records.push_back(record_string);
+
+    record_int = new OptionRecordInt(
+        "presolve_routine_off",
+        "Bit mask of presolve routines that are not allowed: 1 => aggregator; "
+        "2 => sparsify; 4 => parallel rows and columns; 8 => dominated "
+        "columns; 16 => probing; 32 => dependent equations",
+        advanced, &presolve_routine_off, 0, 0, kHighsIInf);
+    records.push_back(record_int);
+
+    record_double = new OptionRecordDouble(
+        "presolve_aggregator_time_limit",
+        "Time limit for the aggregator in presolve", advanced,
+        &presolve_aggregator_time_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
+    record_int = new OptionRecordInt(
+        "presolve_aggregator_call_limit",
+        "Call limit for the aggregator in presolve", advanced,
+        &presolve_aggregator_call_limit, 0, kHighsIInf, kHighsIInf);
+    records.push_back(record_int);
+
+    record_double = new OptionRecordDouble(
+        "presolve_sparsify_time_limit", "Time limit for sparsify in presolve",
+        advanced, &presolve_sparsify_time_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
+    record_int = new OptionRecordInt(
+        "presolve_sparsify_call_limit", "Call limit for sparsify in presolve",
+        advanced, &presolve_sparsify_call_limit, 0, kHighsIInf, kHighsIInf);
+    records.push_back(record_int);
+
+    record_double = new OptionRecordDouble(
+        "presolve_parallel_rows_cols_time_limit",
+        "Time limit for parallel rows and columns in presolve", advanced,
+        &presolve_parallel_rows_cols_time_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
+    record_int = new OptionRecordInt(
+        "presolve_parallel_rows_cols_call_limit",
+        "Call limit for parallel rows and columns in presolve", advanced,
+        &presolve_parallel_rows_cols_call_limit, 0, kHighsIInf, kHighsIInf);
+    records.push_back(record_int);
+
+    record_double = new OptionRecordDouble(
+        "presolve_dominated_cols_time_limit",
+        "Time limit for dominated columns in presolve", advanced,
+        &presolve_dominated_cols_time_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
+    record_int = new OptionRecordInt(
+        "presolve_dominated_cols_call_limit",
+        "Call limit for dominated columns in presolve", advanced,
+        &presolve_dominated_cols_call_limit, 0, kHighsIInf, kHighsIInf);
+    records.push_back(record_int);
+
+    record_double = new OptionRecordDouble(
+        "presolve_probing_time_limit", "Time limit for probing in presolve",
+        advanced, &presolve_probing_time_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
+    record_int = new OptionRecordInt(
+        "presolve_probing_call_limit", "Call limit for probing in presolve",
+        advanced, &presolve_probing_call_limit, 0, kHighsIInf, kHighsIInf);
+    records.push_back(record_int);
+
+    record_double = new OptionRecordDouble(
+        "presolve_dependent_equations_time_limit",
+        "Time limit for dependent equations in presolve", advanced,
+        &presolve_dependent_equations_time_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
+    record_int = new OptionRecordInt(
+        "presolve_dependent_equations_call_limit",
+        "Call limit for dependent equations in presolve", advanced,
+        &presolve_dependent_equations_call_limit, 0, kHighsIInf, kHighsIInf);
+    records.push_back(record_int);
+
+    record_double = new OptionRecordDouble(
+        "presolve_routine_min_nnz_removal_rate",
+        "Nonzeros removed per second below which a presolve routine that can "
+        "be switched off is not called again: 0 => no limit",
+        advanced, &presolve_routine_min_nnz_removal_rate, 0, 0, kHighsInf);
+    records.push_back(record_double);
+
     record_int = new OptionRecordInt(
         "presolve_substitution_maxfillin",
         "Maximal fillin allowed for substitutions in presolve", advanced,
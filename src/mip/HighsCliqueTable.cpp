@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdio>
+#include <memory>
 #include <numeric>
 
 #include "mip/HighsCutPool.h"
@@ -251,7 +252,7 @@ void HighsCliqueTable::bronKerboschRecurse(BronKerboschData& data,
 
   ++data.ncalls;
 
-  if (data.stop(numNeighborhoodQueries)) return;
+  if (data.stop()) return;
 
   double pivweight = -1.0;
   CliqueVar pivot;
@@ -276,10 +277,11 @@ void HighsCliqueTable::bronKerboschRecurse(BronKerboschData& data,
 
   std::vector<CliqueVar> PminusNu;
   PminusNu.reserve(Plen);
-  queryNeighborhood(pivot, data.P.data(), Plen);
-  neighborhoodInds.push_back(Plen);
+  queryNeighborhood(data.neighborhoodInds, data.numQueries, pivot,
+                    data.P.data(), Plen);
+  data.neighborhoodInds.push_back(Plen);
   HighsInt k = 0;
-  for (HighsInt i : neighborhoodInds) {
+  for (HighsInt i : data.neighborhoodInds) {
     while (k < i) PminusNu.push_back(data.P[k++]);
     ++k;
   }
@@ -293,15 +295,18 @@ void HighsCliqueTable::bronKerboschRecurse(BronKerboschData& data,
   localX.insert(localX.end(), X, X + Xlen);
 
   for (CliqueVar v : PminusNu) {
-    HighsInt newPlen = partitionNeighborhood(v, data.P.data(), Plen);
-    HighsInt newXlen = partitionNeighborhood(v, localX.data(), localX.size());
+    HighsInt newPlen = partitionNeighborhood(
+        data.neighborhoodInds, data.numQueries, v, data.P.data(), Plen);
+    HighsInt newXlen =
+        partitionNeighborhood(data.neighborhoodInds, data.numQueries, v,
+                              localX.data(), localX.size());
 
     // add v to R, update the weight, and do the recursive call
     data.R.push_back(v);
     double wv = v.weight(data.sol);
     data.wR += wv;
     bronKerboschRecurse(data, newPlen, localX.data(), newXlen);
-    if (data.stop(numNeighborhoodQueries)) return;
+    if (data.stop()) return;
 
     // remove v from R restore the weight and continue the loop in this call
     data.R.pop_back();
@@ -331,6 +336,157 @@ void HighsCliqueTable::bronKerboschRecurse(BronKerboschData& data,
   }
 }
 
+void HighsCliqueTable::bronKerboschParallel(BronKerboschData& data) {
+  // This is the first level of the recursion for an empty set X. The branches
+  // on the vertices that are not adjacent to the pivot are searched as tasks
+  // in batches of fixed size. The remaining budget of the search is shared
+  // equally by the tasks of a batch and their results are merged in the order
+  // of the branches, so that the cliques do not depend on the scheduling
+  const HighsInt kBatchSize = 16;
+  HighsInt Plen = data.P.size();
+  double w = data.wR;
+
+  for (HighsInt i = 0; i != Plen; ++i) w += data.P[i].weight(data.sol);
+
+  if (w < data.minW - data.feastol) return;
+
+  ++data.ncalls;
+
+  if (data.stop()) return;
+
+  double pivweight = -1.0;
+  CliqueVar pivot;
+
+  for (HighsInt i = 0; i != Plen; ++i) {
+    if (data.P[i].weight(data.sol) > pivweight) {
+      pivweight = data.P[i].weight(data.sol);
+      pivot = data.P[i];
+      if (pivweight >= 1.0 - data.feastol) break;
+    }
+  }
+
+  std::vector<CliqueVar> PminusNu;
+  PminusNu.reserve(Plen);
+  queryNeighborhood(data.neighborhoodInds, data.numQueries, pivot,
+                    data.P.data(), Plen);
+  data.neighborhoodInds.push_back(Plen);
+  HighsInt k = 0;
+  for (HighsInt i : data.neighborhoodInds) {
+    while (k < i) PminusNu.push_back(data.P[k++]);
+    ++k;
+  }
+
+  pdqsort(PminusNu.begin(), PminusNu.end(), [&](CliqueVar a, CliqueVar b) {
+    return std::make_pair(a.weight(data.sol), a.index()) >
+           std::make_pair(b.weight(data.sol), b.index());
+  });
+
+  // vertices of P whose branches have been searched, which are the set X of
+  // the later branches
+  std::vector<CliqueVar> remainingP = data.P;
+  std::vector<CliqueVar> branched;
+  std::vector<std::unique_ptr<BronKerboschData>> tasks;
+  const HighsInt numBranches = PminusNu.size();
+  HighsInt batchStart = 0;
+  while (batchStart < numBranches) {
+    HighsInt numTasks = std::min(kBatchSize, numBranches - batchStart);
+    numTasks = std::min(numTasks, data.maxcalls - data.ncalls);
+    // branches whose remaining weight cannot exceed the weight of the best
+    // cliques found so far are pruned
+    double branchW = w;
+    for (HighsInt t = 0; t < numTasks; ++t) {
+      if (t != 0 && branchW < data.minW) {
+        numTasks = t;
+        break;
+      }
+      branchW -= PminusNu[batchStart + t].weight(data.sol);
+    }
+
+    const HighsInt maxcalls = (data.maxcalls - data.ncalls) / numTasks;
+    const int64_t maxQueries =
+        (data.maxNeighborhoodQueries - data.numQueries) / numTasks;
+    const HighsInt maxcliques = data.maxcliques - data.cliques.size();
+    tasks.clear();
+    for (HighsInt t = 0; t < numTasks; ++t) {
+      tasks.emplace_back(new BronKerboschData(data.sol));
+      BronKerboschData& task = *tasks.back();
+      task.feastol = data.feastol;
+      task.minW = data.minW;
+      task.maxcalls = maxcalls;
+      task.maxcliques = maxcliques;
+      task.maxNeighborhoodQueries = maxQueries;
+    }
+
+    highs::parallel::for_each(
+        0, numTasks,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt t = start; t < end; ++t) {
+            BronKerboschData& task = *tasks[t];
+            CliqueVar v = PminusNu[batchStart + t];
+            task.P = remainingP;
+            std::vector<CliqueVar> X = branched;
+            for (HighsInt j = 0; j < t; ++j) {
+              CliqueVar u = PminusNu[batchStart + j];
+              task.P.erase(std::find(task.P.begin(), task.P.end(), u));
+              X.push_back(u);
+            }
+
+            HighsInt newPlen =
+                partitionNeighborhood(task.neighborhoodInds, task.numQueries,
+                                      v, task.P.data(), task.P.size());
+            HighsInt newXlen =
+                partitionNeighborhood(task.neighborhoodInds, task.numQueries,
+                                      v, X.data(), X.size());
+            task.R.push_back(v);
+            task.wR = v.weight(data.sol);
+            bronKerboschRecurse(task, newPlen, X.data(), newXlen);
+          }
+        },
+        1);
+
+    for (HighsInt t = 0; t < numTasks; ++t) {
+      BronKerboschData& task = *tasks[t];
+      data.ncalls += task.ncalls;
+      data.numQueries += task.numQueries;
+      // cliques the task discarded for cliques of larger weight
+      data.maxcliques -= maxcliques - task.maxcliques;
+      if (!task.cliques.empty()) {
+        if (data.minW < task.minW - data.feastol) {
+          data.maxcliques -= data.cliques.size();
+          data.cliques.clear();
+          data.minW = task.minW;
+        }
+        if (task.minW >= data.minW - data.feastol) {
+          for (std::vector<CliqueVar>& clique : task.cliques) {
+            if (int(data.cliques.size()) >= data.maxcliques) break;
+            data.cliques.emplace_back(std::move(clique));
+          }
+        }
+      }
+
+      CliqueVar v = PminusNu[batchStart + t];
+      remainingP.erase(std::find(remainingP.begin(), remainingP.end(), v));
+      branched.push_back(v);
+      w -= v.weight(data.sol);
+    }
+
+    batchStart += numTasks;
+    if (data.stop() || int(data.cliques.size()) >= data.maxcliques ||
+        w < data.minW)
+      return;
+  }
+}
+
+void HighsCliqueTable::runBronKerbosch(BronKerboschData& data) {
+  // the limit on the neighborhood queries applies to all searches of a solve
+  data.maxNeighborhoodQueries -= numNeighborhoodQueries;
+  if (useParallelism() && data.P.size() > 1)
+    bronKerboschParallel(data);
+  else
+    bronKerboschRecurse(data, data.P.size(), nullptr, 0);
+  numNeighborhoodQueries += data.numQueries;
+}
+
 #if 0
 static void printRow(const HighsDomain& domain, const HighsInt* inds,
                      const double* vals, HighsInt len, double lhs, double rhs) {
@@ -495,6 +651,44 @@ void HighsCliqueTable::doAddClique(const CliqueVar* cliquevars,
                    cliqueentries[cliques[cliqueid].start + 1]),
         cliqueid);
 }
+bool HighsCliqueTable::scanNeighborhood(std::vector<HighsInt>& neighborhoodInds,
+                                        int64_t& numQueries, CliqueVar v,
+                                        const CliqueVar* q, HighsInt N) {
+  // When the cliques containing v have at most as many entries as there are
+  // queried vertices, the neighbors of v are collected from a scan over the
+  // contiguous entries of these cliques. Each queried vertex is then looked up
+  // in a hash set rather than intersecting its clique set tree with the one of
+  // v, which avoids the pointer chasing of the trees for vertices of dense
+  // neighborhoods
+  HighsInt numScanEntries = 0;
+  std::vector<HighsInt> cliqueIds;
+  for (bool sizeTwo : {true, false}) {
+    CliqueSet clqSet(this, v, sizeTwo);
+    for (HighsInt node = clqSet.first(); node != -1;
+         node = clqSet.successor(node)) {
+      const Clique& clique = cliques[cliquesets[node].cliqueid];
+      numScanEntries += clique.end - clique.start;
+      if (numScanEntries > N) return false;
+      cliqueIds.push_back(cliquesets[node].cliqueid);
+    }
+  }
+
+  HighsHashTable<HighsInt> neighbors;
+  for (HighsInt cliqueid : cliqueIds) {
+    for (HighsInt i = cliques[cliqueid].start; i != cliques[cliqueid].end; ++i)
+      if (cliqueentries[i].col != v.col)
+        neighbors.insert(cliqueentries[i].index());
+  }
+  numQueries += numScanEntries;
+
+  for (HighsInt i = 0; i < N; ++i) {
+    if (q[i].col != v.col && neighbors.find(q[i].index()) != nullptr)
+      neighborhoodInds.push_back(i);
+  }
+
+  return true;
+}
+
 struct ThreadNeighborhoodQueryData {
   int64_t numQueries;
   std::vector<HighsInt> neighborhoodInds;
@@ -502,15 +696,22 @@ struct ThreadNeighborhoodQueryData {
 
 void HighsCliqueTable::queryNeighborhood(CliqueVar v, CliqueVar* q,
                                          HighsInt N) {
+  queryNeighborhood(neighborhoodInds, numNeighborhoodQueries, v, q, N);
+}
+
+void HighsCliqueTable::queryNeighborhood(
+    std::vector<HighsInt>& neighborhoodInds, int64_t& numQueries, CliqueVar v,
+    CliqueVar* q, HighsInt N) {
   neighborhoodInds.clear();
   if (sizeTwoCliquesetTree[v.index()].root == -1 &&
       cliquesetTree[v.index()].root == -1)
     return;
 
-  if (numEntries - sizeTwoCliques.size() * 2 < minEntriesForParallelism) {
+  if (scanNeighborhood(neighborhoodInds, numQueries, v, q, N)) return;
+
+  if (!useParallelism()) {
     for (HighsInt i = 0; i < N; ++i) {
-      if (haveCommonClique(numNeighborhoodQueries, v, q[i]))
-        neighborhoodInds.push_back(i);
+      if (haveCommonClique(numQueries, v, q[i])) neighborhoodInds.push_back(i);
     }
   } else {
     auto neighborhoodData =
@@ -535,7 +736,7 @@ void HighsCliqueTable::queryNeighborhood(CliqueVar v, CliqueVar* q,
       neighborhoodInds.insert(neighborhoodInds.end(),
                               d.neighborhoodInds.begin(),
                               d.neighborhoodInds.end());
-      numNeighborhoodQueries += d.numQueries;
+      numQueries += d.numQueries;
     });
     pdqsort(neighborhoodInds.begin(), neighborhoodInds.end());
   }
@@ -543,7 +744,14 @@ void HighsCliqueTable::queryNeighborhood(CliqueVar v, CliqueVar* q,
 
 HighsInt HighsCliqueTable::partitionNeighborhood(CliqueVar v, CliqueVar* q,
                                                  HighsInt N) {
-  queryNeighborhood(v, q, N);
+  return partitionNeighborhood(neighborhoodInds, numNeighborhoodQueries, v, q,
+                               N);
+}
+
+HighsInt HighsCliqueTable::partitionNeighborhood(
+    std::vector<HighsInt>& neighborhoodInds, int64_t& numQueries, CliqueVar v,
+    CliqueVar* q, HighsInt N) {
+  queryNeighborhood(neighborhoodInds, numQueries, v, q, N);
 
   for (HighsInt i = 0; i < (HighsInt)neighborhoodInds.size(); ++i)
     std::swap(q[i], q[neighborhoodInds[i]]);
@@ -892,6 +1100,21 @@ void HighsCliqueTable::addClique(const HighsMipSolver& mipsolver,
   processInfeasibleVertices(globaldom);
 }
 
+void HighsCliqueTable::getCliques(std::vector<CliqueVar>& cliqueVars,
+                                  std::vector<HighsInt>& cliqueEnds,
+                                  std::vector<uint8_t>& equality) const {
+  cliqueVars.clear();
+  cliqueEnds.clear();
+  equality.clear();
+  for (const Clique& clique : cliques) {
+    if (clique.start == -1) continue;
+    cliqueVars.insert(cliqueVars.end(), cliqueentries.begin() + clique.start,
+                      cliqueentries.begin() + clique.end);
+    cliqueEnds.push_back(cliqueVars.size());
+    equality.push_back(clique.equality);
+  }
+}
+
 void HighsCliqueTable::removeClique(HighsInt cliqueid) {
   if (cliques[cliqueid].origin != kHighsIInf && cliques[cliqueid].origin != -1)
     deletedrows.push_back(cliques[cliqueid].origin);
@@ -917,13 +1140,15 @@ void HighsCliqueTable::removeClique(HighsInt cliqueid) {
   numEntries -= len;
 }
 
-void HighsCliqueTable::extractCliques(
-    const HighsMipSolver& mipsolver, std::vector<HighsInt>& inds,
-    std::vector<double>& vals, std::vector<int8_t>& complementation, double rhs,
-    HighsInt nbin, std::vector<HighsInt>& perm, std::vector<CliqueVar>& clique,
-    double feastol) {
-  HighsImplications& implics = mipsolver.mipdata_->implications;
-  HighsDomain& globaldom = mipsolver.mipdata_->domain;
+void HighsCliqueTable::extractCliques(const HighsMipSolver& mipsolver,
+                                      RowExtractionBuffer& buffer, double rhs,
+                                      HighsInt nbin, double feastol) const {
+  const HighsDomain& globaldom = mipsolver.mipdata_->domain;
+  std::vector<HighsInt>& inds = buffer.inds;
+  std::vector<double>& vals = buffer.vals;
+  std::vector<int8_t>& complementation = buffer.complementation;
+  std::vector<HighsInt>& perm = buffer.perm;
+  std::vector<CliqueVar>& clique = buffer.clique;
 
   perm.resize(inds.size());
   std::iota(perm.begin(), perm.end(), 0);
@@ -962,10 +1187,12 @@ void HighsCliqueTable::extractCliques(
 
           if (complementation[perm[j]] == -1) {
             constant -= globaldom.col_upper_[col];
-            implics.addVLB(col, bincol, -double(coef), -double(constant));
+            buffer.varbounds.push_back(RowExtractionBuffer::VarBound{
+                col, bincol, -double(coef), -double(constant), false});
           } else {
             constant += globaldom.col_lower_[col];
-            implics.addVUB(col, bincol, double(coef), double(constant));
+            buffer.varbounds.push_back(RowExtractionBuffer::VarBound{
+                col, bincol, double(coef), double(constant), true});
           }
         }
       }
@@ -1001,8 +1228,7 @@ void HighsCliqueTable::extractCliques(
         clique.emplace_back(inds[pos], 1);
     }
 
-    addClique(mipsolver, clique.data(), nbin);
-    if (globaldom.infeasible()) return;
+    buffer.addClique();
     // printf("extracted this clique:\n");
     // printClique(clique);
     return;
@@ -1039,8 +1265,7 @@ void HighsCliqueTable::extractCliques(
       // if (clique.size() > 2) runCliqueSubsumption(globaldom, clique);
       // runCliqueMerging(globaldom, clique);
       // if (clique.size() >= 2) {
-      addClique(mipsolver, clique.data(), clique.size());
-      if (globaldom.infeasible()) return;
+      buffer.addClique();
       //}
     }
 
@@ -1322,170 +1547,239 @@ void HighsCliqueTable::extractCliquesFromCut(const HighsMipSolver& mipsolver,
   }
 }
 
-void HighsCliqueTable::extractCliques(HighsMipSolver& mipsolver,
-                                      bool transformRows) {
-  std::vector<HighsInt> inds;
-  std::vector<double> vals;
-  std::vector<HighsInt> perm;
-  std::vector<int8_t> complementation;
-  std::vector<CliqueVar> clique;
-  HighsHashTable<HighsInt, double> entries;
+void HighsCliqueTable::extractRowCliques(const HighsMipSolver& mipsolver,
+                                         HighsInt i, bool transformRows,
+                                         RowExtractionBuffer& buffer) const {
+  const HighsDomain& globaldom = mipsolver.mipdata_->domain;
+  std::vector<HighsInt>& inds = buffer.inds;
+  std::vector<double>& vals = buffer.vals;
+  std::vector<int8_t>& complementation = buffer.complementation;
+  std::vector<CliqueVar>& clique = buffer.clique;
+  HighsHashTable<HighsInt, double>& entries = buffer.entries;
   double offset;
 
   double rhs;
 
-  HighsDomain& globaldom = mipsolver.mipdata_->domain;
+  HighsInt start = mipsolver.mipdata_->ARstart_[i];
+  HighsInt end = mipsolver.mipdata_->ARstart_[i + 1];
 
-  for (HighsInt i = 0; i != mipsolver.numRow(); ++i) {
-    HighsInt start = mipsolver.mipdata_->ARstart_[i];
-    HighsInt end = mipsolver.mipdata_->ARstart_[i + 1];
+  // catch set packing and partitioning constraints that already have the form
+  // of a clique without transformations and add those cliques with the rows
+  // being recorded
+  if (mipsolver.rowUpper(i) == 1.0) {
+    bool issetppc = true;
 
-    if (mipsolver.mipdata_->postSolveStack.getOrigRowIndex(i) >=
-        mipsolver.orig_model_->num_row_)
-      break;
+    clique.clear();
 
-    // catch set packing and partitioning constraints that already have the form
-    // of a clique without transformations and add those cliques with the rows
-    // being recorded
-    if (mipsolver.rowUpper(i) == 1.0) {
-      bool issetppc = true;
+    for (HighsInt j = start; j != end; ++j) {
+      HighsInt col = mipsolver.mipdata_->ARindex_[j];
+      if (globaldom.col_upper_[col] == 0.0 && globaldom.col_lower_[col] == 0.0)
+        continue;
+      if (!globaldom.isBinary(col)) {
+        issetppc = false;
+        break;
+      }
 
-      clique.clear();
+      if (mipsolver.mipdata_->ARvalue_[j] != 1.0) {
+        issetppc = false;
+        break;
+      }
 
-      for (HighsInt j = start; j != end; ++j) {
-        HighsInt col = mipsolver.mipdata_->ARindex_[j];
-        if (globaldom.col_upper_[col] == 0.0 &&
-            globaldom.col_lower_[col] == 0.0)
-          continue;
-        if (!globaldom.isBinary(col)) {
-          issetppc = false;
+      clique.emplace_back(col, 1);
+    }
+
+    if (issetppc) {
+      bool equality = mipsolver.rowLower(i) == 1.0;
+      buffer.addClique(equality, i);
+      return;
+    }
+  }
+  if (!transformRows) return;
+
+  offset = 0;
+  for (HighsInt j = start; j != end; ++j) {
+    HighsInt col = mipsolver.mipdata_->ARindex_[j];
+    double val = mipsolver.mipdata_->ARvalue_[j];
+
+    resolveSubstitution(col, val, offset);
+    entries[col] += val;
+  }
+
+  if (mipsolver.rowUpper(i) != kHighsInf) {
+    rhs = mipsolver.rowUpper(i) - offset;
+    inds.clear();
+    vals.clear();
+    complementation.clear();
+    bool freevar = false;
+    HighsInt nbin = 0;
+
+    for (const auto& entry : entries) {
+      HighsInt col = entry.key();
+      double val = entry.value();
+
+      if (std::abs(val) < mipsolver.mipdata_->epsilon) continue;
+
+      if (globaldom.isBinary(col)) ++nbin;
+
+      if (val < 0) {
+        if (globaldom.col_upper_[col] == kHighsInf) {
+          freevar = true;
           break;
         }
 
-        if (mipsolver.mipdata_->ARvalue_[j] != 1.0) {
-          issetppc = false;
+        vals.push_back(-val);
+        inds.push_back(col);
+        complementation.push_back(-1);
+        rhs -= val * globaldom.col_upper_[col];
+      } else {
+        if (globaldom.col_lower_[col] == -kHighsInf) {
+          freevar = true;
           break;
         }
 
-        clique.emplace_back(col, 1);
-      }
-
-      if (issetppc) {
-        bool equality = mipsolver.rowLower(i) == 1.0;
-        addClique(mipsolver, clique.data(), clique.size(), equality, i);
-        if (globaldom.infeasible()) return;
-        continue;
+        vals.push_back(val);
+        inds.push_back(col);
+        complementation.push_back(1);
+        rhs -= val * globaldom.col_lower_[col];
       }
     }
-    if (!transformRows || isFull()) continue;
-
-    offset = 0;
-    for (HighsInt j = start; j != end; ++j) {
-      HighsInt col = mipsolver.mipdata_->ARindex_[j];
-      double val = mipsolver.mipdata_->ARvalue_[j];
 
-      resolveSubstitution(col, val, offset);
-      entries[col] += val;
+    if (!freevar && nbin != 0) {
+      // printf("extracing cliques from this row:\n");
+      // printRow(globaldom, inds.data(), vals.data(), inds.size(),
+      //         -kHighsInf, rhs);
+      extractCliques(mipsolver, buffer, rhs, nbin,
+                     mipsolver.mipdata_->feastol);
     }
+  }
 
-    if (mipsolver.rowUpper(i) != kHighsInf) {
-      rhs = mipsolver.rowUpper(i) - offset;
-      inds.clear();
-      vals.clear();
-      complementation.clear();
-      bool freevar = false;
-      HighsInt nbin = 0;
-
-      for (const auto& entry : entries) {
-        HighsInt col = entry.key();
-        double val = entry.value();
-
-        if (std::abs(val) < mipsolver.mipdata_->epsilon) continue;
+  if (mipsolver.rowLower(i) != -kHighsInf) {
+    rhs = -mipsolver.rowLower(i) + offset;
+    inds.clear();
+    vals.clear();
+    complementation.clear();
+    bool freevar = false;
+    HighsInt nbin = 0;
 
-        if (globaldom.isBinary(col)) ++nbin;
+    for (const auto& entry : entries) {
+      HighsInt col = entry.key();
+      double val = -entry.value();
+      if (std::abs(val) < mipsolver.mipdata_->epsilon) continue;
 
-        if (val < 0) {
-          if (globaldom.col_upper_[col] == kHighsInf) {
-            freevar = true;
-            break;
-          }
+      if (globaldom.isBinary(col)) ++nbin;
 
-          vals.push_back(-val);
-          inds.push_back(col);
-          complementation.push_back(-1);
-          rhs -= val * globaldom.col_upper_[col];
-        } else {
-          if (globaldom.col_lower_[col] == -kHighsInf) {
-            freevar = true;
-            break;
-          }
+      if (val < 0) {
+        if (globaldom.col_upper_[col] == kHighsInf) {
+          freevar = true;
+          break;
+        }
 
-          vals.push_back(val);
-          inds.push_back(col);
-          complementation.push_back(1);
-          rhs -= val * globaldom.col_lower_[col];
+        vals.push_back(-val);
+        inds.push_back(col);
+        complementation.push_back(-1);
+        rhs -= val * globaldom.col_upper_[col];
+      } else {
+        if (globaldom.col_lower_[col] == -kHighsInf) {
+          freevar = true;
+          break;
         }
-      }
 
-      if (!freevar && nbin != 0) {
-        // printf("extracing cliques from this row:\n");
-        // printRow(globaldom, inds.data(), vals.data(), inds.size(),
-        //         -kHighsInf, rhs);
-        extractCliques(mipsolver, inds, vals, complementation, rhs, nbin, perm,
-                       clique, mipsolver.mipdata_->feastol);
-        if (globaldom.infeasible()) return;
+        vals.push_back(val);
+        inds.push_back(col);
+        complementation.push_back(1);
+        rhs -= val * globaldom.col_lower_[col];
       }
     }
 
-    if (mipsolver.rowLower(i) != -kHighsInf) {
-      rhs = -mipsolver.rowLower(i) + offset;
-      inds.clear();
-      vals.clear();
-      complementation.clear();
-      bool freevar = false;
-      HighsInt nbin = 0;
+    if (!freevar && nbin != 0) {
+      // printf("extracing cliques from this row:\n");
+      // printRow(globaldom, inds.data(), vals.data(), inds.size(),
+      //         -kHighsInf, rhs);
+      extractCliques(mipsolver, buffer, rhs, nbin,
+                     mipsolver.mipdata_->feastol);
+    }
+  }
 
-      for (const auto& entry : entries) {
-        HighsInt col = entry.key();
-        double val = -entry.value();
-        if (std::abs(val) < mipsolver.mipdata_->epsilon) continue;
+  entries.clear();
+}
 
-        if (globaldom.isBinary(col)) ++nbin;
+void HighsCliqueTable::addExtractedCliques(HighsMipSolver& mipsolver,
+                                           RowExtractionBuffer& buffer) {
+  HighsImplications& implics = mipsolver.mipdata_->implications;
+  HighsDomain& globaldom = mipsolver.mipdata_->domain;
 
-        if (val < 0) {
-          if (globaldom.col_upper_[col] == kHighsInf) {
-            freevar = true;
-            break;
-          }
+  // cliques and variable bounds from transformed rows are only added while
+  // the table is not full
+  for (const RowExtractionBuffer::VarBound& vb : buffer.varbounds) {
+    if (isFull()) break;
+    if (vb.upper)
+      implics.addVUB(vb.col, vb.bincol, vb.coef, vb.constant);
+    else
+      implics.addVLB(vb.col, vb.bincol, vb.coef, vb.constant);
+  }
 
-          vals.push_back(-val);
-          inds.push_back(col);
-          complementation.push_back(-1);
-          rhs -= val * globaldom.col_upper_[col];
-        } else {
-          if (globaldom.col_lower_[col] == -kHighsInf) {
-            freevar = true;
-            break;
-          }
+  HighsInt start = 0;
+  const HighsInt numCliques = buffer.cliqueend.size();
+  for (HighsInt k = 0; k != numCliques; ++k) {
+    HighsInt end = buffer.cliqueend[k];
+    HighsInt origin = buffer.cliqueorigin[k];
+    if (origin != kHighsIInf || !isFull()) {
+      addClique(mipsolver, buffer.cliquevars.data() + start, end - start,
+                buffer.cliqueequality[k], origin);
+      if (globaldom.infeasible()) break;
+    }
+    start = end;
+  }
 
-          vals.push_back(val);
-          inds.push_back(col);
-          complementation.push_back(1);
-          rhs -= val * globaldom.col_lower_[col];
-        }
-      }
+  buffer.cliquevars.clear();
+  buffer.cliqueend.clear();
+  buffer.cliqueorigin.clear();
+  buffer.cliqueequality.clear();
+  buffer.varbounds.clear();
+}
 
-      if (!freevar && nbin != 0) {
-        // printf("extracing cliques from this row:\n");
-        // printRow(globaldom, inds.data(), vals.data(), inds.size(),
-        //         -kHighsInf, rhs);
-        extractCliques(mipsolver, inds, vals, complementation, rhs, nbin, perm,
-                       clique, mipsolver.mipdata_->feastol);
-        if (globaldom.infeasible()) return;
-      }
+void HighsCliqueTable::extractCliques(HighsMipSolver& mipsolver,
+                                      bool transformRows) {
+  HighsDomain& globaldom = mipsolver.mipdata_->domain;
+
+  // rows that were added to the model after presolve are not considered
+  HighsInt numRow = 0;
+  while (numRow != mipsolver.numRow() &&
+         mipsolver.mipdata_->postSolveStack.getOrigRowIndex(numRow) <
+             mipsolver.orig_model_->num_row_)
+    ++numRow;
+
+  if (mipsolver.numNonzero() < minEntriesForParallelism) {
+    RowExtractionBuffer buffer;
+    for (HighsInt i = 0; i != numRow; ++i) {
+      extractRowCliques(mipsolver, i, transformRows && !isFull(), buffer);
+      addExtractedCliques(mipsolver, buffer);
+      if (globaldom.infeasible()) return;
     }
+    return;
+  }
+
+  // extract the cliques of blocks of rows concurrently, and add them in the
+  // order of the rows afterwards so that the clique table does not depend on
+  // the scheduling
+  const HighsInt kBlockSize = 1024;
+  const HighsInt numBlocks = (numRow + kBlockSize - 1) / kBlockSize;
+  const bool transform = transformRows && !isFull();
+  std::vector<RowExtractionBuffer> buffers(numBlocks);
+  highs::parallel::for_each(
+      0, numBlocks,
+      [&](HighsInt start, HighsInt end) {
+        for (HighsInt block = start; block < end; ++block) {
+          HighsInt blockEnd = std::min(numRow, (block + 1) * kBlockSize);
+          for (HighsInt i = block * kBlockSize; i < blockEnd; ++i)
+            extractRowCliques(mipsolver, i, transform, buffers[block]);
+        }
+      },
+      1);
 
-    entries.clear();
+  for (RowExtractionBuffer& buffer : buffers) {
+    addExtractedCliques(mipsolver, buffer);
+    if (globaldom.infeasible()) return;
   }
 }
 
@@ -1757,7 +2051,7 @@ void HighsCliqueTable::separateCliques(const HighsMipSolver& mipsolver,
   }
 
   // auto t1 = std::chrono::high_resolution_clock::now();
-  bronKerboschRecurse(data, data.P.size(), nullptr, 0);
+  runBronKerbosch(data);
 
   // auto t2 = std::chrono::high_resolution_clock::now();
 
@@ -1844,7 +2138,7 @@ HighsCliqueTable::separateCliques(const std::vector<double>& sol,
       data.P.emplace_back(i, 1);
   }
 
-  bronKerboschRecurse(data, data.P.size(), nullptr, 0);
+  runBronKerbosch(data);
 
   return std::move(data.cliques);
 }
@@ -141,11 +141,16 @@ class HighsCliqueTable {
     HighsInt ncalls = 0;
     HighsInt maxcalls = 10000;
     HighsInt maxcliques = 100;
+    // the neighborhood queries of this search, which are limited by
+    // maxNeighborhoodQueries, use their own index buffer so that searches
+    // can run concurrently
+    std::vector<HighsInt> neighborhoodInds;
+    int64_t numQueries = 0;
     int64_t maxNeighborhoodQueries = std::numeric_limits<int64_t>::max();
 
-    bool stop(int64_t numNeighborhoodQueries) const {
+    bool stop() const {
       return maxcalls == ncalls || int(cliques.size()) == maxcliques ||
-             numNeighborhoodQueries > maxNeighborhoodQueries;
+             numQueries > maxNeighborhoodQueries;
     }
 
     BronKerboschData(const std::vector<double>& sol) : sol(sol) {}
@@ -154,11 +159,50 @@ class HighsCliqueTable {
   void bronKerboschRecurse(BronKerboschData& data, HighsInt Plen,
                            const CliqueVar* X, HighsInt Xlen);
 
+  void bronKerboschParallel(BronKerboschData& data);
+
+  void runBronKerbosch(BronKerboschData& data);
+
+  // cliques and variable bounds extracted from a block of rows, which are
+  // added to the clique table and the implications in the order of the rows
+  struct RowExtractionBuffer {
+    struct VarBound {
+      HighsInt col;
+      HighsInt bincol;
+      double coef;
+      double constant;
+      bool upper;
+    };
+    std::vector<CliqueVar> cliquevars;
+    std::vector<HighsInt> cliqueend;
+    std::vector<HighsInt> cliqueorigin;
+    std::vector<uint8_t> cliqueequality;
+    std::vector<VarBound> varbounds;
+
+    std::vector<HighsInt> inds;
+    std::vector<double> vals;
+    std::vector<HighsInt> perm;
+    std::vector<int8_t> complementation;
+    std::vector<CliqueVar> clique;
+    HighsHashTable<HighsInt, double> entries;
+
+    void addClique(bool equality = false, HighsInt origin = kHighsIInf) {
+      cliquevars.insert(cliquevars.end(), clique.begin(), clique.end());
+      cliqueend.push_back(cliquevars.size());
+      cliqueorigin.push_back(origin);
+      cliqueequality.push_back(equality);
+    }
+  };
+
   void extractCliques(const HighsMipSolver& mipsolver,
-                      std::vector<HighsInt>& inds, std::vector<double>& vals,
-                      std::vector<int8_t>& complementation, double rhs,
-                      HighsInt nbin, std::vector<HighsInt>& perm,
-                      std::vector<CliqueVar>& clique, double feastol);
+                      RowExtractionBuffer& buffer, double rhs, HighsInt nbin,
+                      double feastol) const;
+
+  void extractRowCliques(const HighsMipSolver& mipsolver, HighsInt row,
+                         bool transformRows, RowExtractionBuffer& buffer) const;
+
+  void addExtractedCliques(HighsMipSolver& mipsolver,
+                           RowExtractionBuffer& buffer);
 
   void processInfeasibleVertices(HighsDomain& domain);
 
@@ -166,6 +210,23 @@ class HighsCliqueTable {
 
   void queryNeighborhood(CliqueVar v, CliqueVar* q, HighsInt N);
 
+  void queryNeighborhood(std::vector<HighsInt>& neighborhoodInds,
+                         int64_t& numQueries, CliqueVar v, CliqueVar* q,
+                         HighsInt N);
+
+  bool scanNeighborhood(std::vector<HighsInt>& neighborhoodInds,
+                        int64_t& numQueries, CliqueVar v, const CliqueVar* q,
+                        HighsInt N);
+
+  HighsInt partitionNeighborhood(std::vector<HighsInt>& neighborhoodInds,
+                                 int64_t& numQueries, CliqueVar v, CliqueVar* q,
+                                 HighsInt N);
+
+  bool useParallelism() const {
+    return numEntries - HighsInt(sizeTwoCliques.size()) * 2 >=
+           minEntriesForParallelism;
+  }
+
  public:
   int64_t numNeighborhoodQueries;
 
@@ -205,6 +266,13 @@ class HighsCliqueTable {
 
   void removeClique(HighsInt cliqueid);
 
+  // returns the cliques as consecutive lists of variables, where the list of
+  // the i-th clique ends at position cliqueEnds[i] and equality[i] tells
+  // whether it is an equality clique
+  void getCliques(std::vector<CliqueVar>& cliqueVars,
+                  std::vector<HighsInt>& cliqueEnds,
+                  std::vector<uint8_t>& equality) const;
+
   void resolveSubstitution(CliqueVar& v) const;
 
   void resolveSubstitution(HighsInt& col, double& val, double& rhs) const;
@@ -14,14 +14,47 @@
 #include "mip/HighsConflictPool.h"
 
 #include "mip/HighsDomain.h"
+#include "mip/HighsMipSolverData.h"
+
+void HighsConflictPool::minimizeConflict(const HighsDomain& domain) {
+  // drop bound changes that are already implied by the global domain, as long
+  // as the conflict does not become empty, and keep only the tightest bound
+  // change when a column appears more than once with the same bound type
+  const HighsDomain& globaldom = domain.getMipSolver()->mipdata_->domain;
+  HighsInt numEntries = conflictBuffer_.size();
+  HighsInt k = 0;
+  for (HighsInt i = 0; i != numEntries; ++i) {
+    const HighsDomainChange& domchg = conflictBuffer_[i];
+    if (globaldom.isActive(domchg) && (k != 0 || i + 1 != numEntries))
+      continue;
+
+    bool redundant = false;
+    for (HighsInt j = 0; j != k; ++j) {
+      HighsDomainChange& kept = conflictBuffer_[j];
+      if (kept.column != domchg.column || kept.boundtype != domchg.boundtype)
+        continue;
+
+      if (domchg.boundtype == HighsBoundType::kLower)
+        kept.boundval = std::max(kept.boundval, domchg.boundval);
+      else
+        kept.boundval = std::min(kept.boundval, domchg.boundval);
+      redundant = true;
+      break;
+    }
+
+    if (!redundant) conflictBuffer_[k++] = domchg;
+  }
+
+  conflictBuffer_.resize(k);
+}
+
+void HighsConflictPool::addConflictFromBuffer(const HighsDomain& domain) {
+  minimizeConflict(domain);
 
-void HighsConflictPool::addConflictCut(
-    const HighsDomain& domain,
-    const std::set<HighsDomain::ConflictSet::LocalDomChg>& reasonSideFrontier) {
   HighsInt conflictIndex;
   HighsInt start;
   HighsInt end;
-  HighsInt conflictLen = reasonSideFrontier.size();
+  HighsInt conflictLen = conflictBuffer_.size();
   std::set<std::pair<HighsInt, HighsInt>>::iterator it;
   if (freeSpaces_.empty() ||
       (it = freeSpaces_.lower_bound(
@@ -50,6 +83,7 @@ void HighsConflictPool::addConflictCut(
     conflictRanges_.emplace_back(start, end);
     ages_.resize(conflictRanges_.size());
     modification_.resize(conflictRanges_.size());
+    usage_.resize(conflictRanges_.size());
   } else {
     conflictIndex = deletedConflicts_.back();
     deletedConflicts_.pop_back();
@@ -58,19 +92,13 @@ void HighsConflictPool::addConflictCut(
   }
 
   modification_[conflictIndex] += 1;
+  usage_[conflictIndex] = ConflictUsage();
   ages_[conflictIndex] = 0;
   ageDistribution_[ages_[conflictIndex]] += 1;
 
-  HighsInt i = start;
-  const std::vector<HighsDomainChange>& domchgStack_ =
-      domain.getDomainChangeStack();
   double feastol = domain.feastol();
-  for (const HighsDomain::ConflictSet::LocalDomChg& domchg :
-       reasonSideFrontier) {
-    assert(i < end);
-    assert(domchg.pos >= 0);
-    assert(domchg.pos < (HighsInt)domchgStack_.size());
-    conflictEntries_[i] = domchg.domchg;
+  for (HighsInt i = start; i != end; ++i) {
+    conflictEntries_[i] = conflictBuffer_[i - start];
     if (domain.variableType(conflictEntries_[i].column) ==
         HighsVarType::kContinuous) {
       if (conflictEntries_[i].boundtype == HighsBoundType::kLower)
@@ -78,83 +106,66 @@ void HighsConflictPool::addConflictCut(
       else
         conflictEntries_[i].boundval -= feastol;
     }
-    ++i;
   }
 
   for (HighsDomain::ConflictPoolPropagation* conflictProp : propagationDomains)
     conflictProp->conflictAdded(conflictIndex);
 }
 
+void HighsConflictPool::addConflictCut(
+    const HighsDomain& domain,
+    const std::set<HighsDomain::ConflictSet::LocalDomChg>& reasonSideFrontier) {
+  const std::vector<HighsDomainChange>& domchgStack_ =
+      domain.getDomainChangeStack();
+  conflictBuffer_.clear();
+  for (const HighsDomain::ConflictSet::LocalDomChg& domchg :
+       reasonSideFrontier) {
+    assert(domchg.pos >= 0);
+    assert(domchg.pos < (HighsInt)domchgStack_.size());
+    conflictBuffer_.push_back(domchg.domchg);
+  }
+
+  ++numConflictsLearned_;
+  addConflictFromBuffer(domain);
+}
+
 void HighsConflictPool::addReconvergenceCut(
     const HighsDomain& domain,
     const std::set<HighsDomain::ConflictSet::LocalDomChg>&
         reconvergenceFrontier,
     const HighsDomainChange& reconvergenceDomchg) {
-  HighsInt conflictIndex;
-  HighsInt start;
-  HighsInt end;
-  HighsInt conflictLen = reconvergenceFrontier.size() + 1;
-  std::set<std::pair<HighsInt, HighsInt>>::iterator it;
-  if (freeSpaces_.empty() ||
-      (it = freeSpaces_.lower_bound(
-           std::make_pair(conflictLen, HighsInt{-1}))) == freeSpaces_.end()) {
-    start = conflictEntries_.size();
-    end = start + conflictLen;
-
-    conflictEntries_.resize(end);
-  } else {
-    std::pair<HighsInt, HighsInt> freeslot = *it;
-    freeSpaces_.erase(it);
-
-    start = freeslot.second;
-    end = start + conflictLen;
-    // if the space was not completely occupied, we register the remainder of
-    // it again in the priority queue
-    if (freeslot.first > conflictLen) {
-      freeSpaces_.emplace(freeslot.first - conflictLen, end);
-    }
-  }
-
-  // register the range of entries for this conflict with a reused or a new
-  // index
-  if (deletedConflicts_.empty()) {
-    conflictIndex = conflictRanges_.size();
-    conflictRanges_.emplace_back(start, end);
-    ages_.resize(conflictRanges_.size());
-    modification_.resize(conflictRanges_.size());
-  } else {
-    conflictIndex = deletedConflicts_.back();
-    deletedConflicts_.pop_back();
-    conflictRanges_[conflictIndex].first = start;
-    conflictRanges_[conflictIndex].second = end;
-  }
-
-  modification_[conflictIndex] += 1;
-  ages_[conflictIndex] = 0;
-  ageDistribution_[ages_[conflictIndex]] += 1;
-
-  HighsInt i = start;
   const std::vector<HighsDomainChange>& domchgStack_ =
       domain.getDomainChangeStack();
-  assert(i < end);
-  conflictEntries_[i++] = domain.flip(reconvergenceDomchg);
-  double feastol = domain.feastol();
+  conflictBuffer_.clear();
+  conflictBuffer_.push_back(domain.flip(reconvergenceDomchg));
   for (const HighsDomain::ConflictSet::LocalDomChg& domchg :
        reconvergenceFrontier) {
-    assert(i < end);
     assert(domchg.pos >= 0);
     assert(domchg.pos < (HighsInt)domchgStack_.size());
-    conflictEntries_[i] = domchg.domchg;
-    if (domain.variableType(conflictEntries_[i].column) ==
-        HighsVarType::kContinuous) {
-      if (conflictEntries_[i].boundtype == HighsBoundType::kLower)
-        conflictEntries_[i].boundval += feastol;
-      else
-        conflictEntries_[i].boundval -= feastol;
-    }
-    ++i;
+    conflictBuffer_.push_back(domchg.domchg);
   }
 
+  ++numConflictsLearned_;
+  addConflictFromBuffer(domain);
+}
+
+void HighsConflictPool::addConflict(const HighsDomainChange* conflict,
+                                    HighsInt conflictLen) {
+  HighsInt start = conflictEntries_.size();
+  HighsInt end = start + conflictLen;
+  conflictEntries_.insert(conflictEntries_.end(), conflict,
+                          conflict + conflictLen);
+
+  HighsInt conflictIndex = conflictRanges_.size();
+  conflictRanges_.emplace_back(start, end);
+  ages_.resize(conflictRanges_.size());
+  modification_.resize(conflictRanges_.size());
+  usage_.resize(conflictRanges_.size());
+
+  modification_[conflictIndex] += 1;
+  ages_[conflictIndex] = 0;
+  ageDistribution_[ages_[conflictIndex]] += 1;
+
   for (HighsDomain::ConflictPoolPropagation* conflictProp : propagationDomains)
     conflictProp->conflictAdded(conflictIndex);
 }
@@ -194,8 +205,10 @@ void HighsConflictPool::performAging() {
   for (HighsInt i = 0; i != conflictMaxIndex; ++i) {
     if (ages_[i] < 0) continue;
 
+    // conflicts that have neither propagated nor cut off a node since they
+    // were added age twice as fast
     ageDistribution_[ages_[i]] -= 1;
-    ages_[i] += 1;
+    ages_[i] += usage_[i].propagations == 0 && usage_[i].cutoffs == 0 ? 2 : 1;
 
     if (ages_[i] > agelim) {
       ages_[i] = -1;
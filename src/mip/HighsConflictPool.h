@@ -20,12 +20,22 @@
 #include "util/HighsInt.h"
 
 class HighsConflictPool {
+ public:
+  // number of bound changes and infeasible nodes a conflict has led to since
+  // it was added to the pool
+  struct ConflictUsage {
+    uint32_t propagations = 0;
+    uint32_t cutoffs = 0;
+  };
+
  private:
   HighsInt agelim_;
   HighsInt softlimit_;
   std::vector<HighsInt> ageDistribution_;
   std::vector<int16_t> ages_;
   std::vector<unsigned> modification_;
+  std::vector<ConflictUsage> usage_;
+  std::vector<HighsDomainChange> conflictBuffer_;
 
   std::vector<HighsDomainChange> conflictEntries_;
   std::vector<std::pair<HighsInt, HighsInt>> conflictRanges_;
@@ -39,6 +49,13 @@ class HighsConflictPool {
 
   std::vector<HighsDomain::ConflictPoolPropagation*> propagationDomains;
 
+  /// number of conflicts that were learned by conflict analysis
+  int64_t numConflictsLearned_;
+
+  void minimizeConflict(const HighsDomain& domain);
+
+  void addConflictFromBuffer(const HighsDomain& domain);
+
  public:
   HighsConflictPool(HighsInt agelim, HighsInt softlimit)
       : agelim_(agelim),
@@ -46,11 +63,14 @@ class HighsConflictPool {
         ageDistribution_(),
         ages_(),
         modification_(),
+        usage_(),
+        conflictBuffer_(),
         conflictEntries_(),
         conflictRanges_(),
         freeSpaces_(),
         deletedConflicts_(),
-        propagationDomains() {
+        propagationDomains(),
+        numConflictsLearned_(0) {
     ageDistribution_.resize(agelim_ + 1);
   }
 
@@ -64,6 +84,10 @@ class HighsConflictPool {
           reconvergenceFrontier,
       const HighsDomainChange& reconvergenceDomchg);
 
+  // adds a conflict that is given by its domain changes, e.g. when the
+  // conflicts of a checkpoint are restored
+  void addConflict(const HighsDomainChange* conflict, HighsInt conflictLen);
+
   void removeConflict(HighsInt conflict);
 
   void performAging();
@@ -76,6 +100,20 @@ class HighsConflictPool {
     }
   }
 
+  void conflictPropagated(HighsInt conflict) {
+    resetAge(conflict);
+    ++usage_[conflict].propagations;
+  }
+
+  void conflictCutoff(HighsInt conflict) {
+    resetAge(conflict);
+    ++usage_[conflict].cutoffs;
+  }
+
+  const ConflictUsage& getUsage(HighsInt conflict) const {
+    return usage_[conflict];
+  }
+
   void setAgeLimit(HighsInt agelim) {
     agelim_ = agelim;
     ageDistribution_.resize(agelim_ + 1);
@@ -109,6 +147,8 @@ class HighsConflictPool {
   HighsInt getNumConflicts() const {
     return conflictRanges_.size() - deletedConflicts_.size();
   }
+
+  int64_t getNumConflictsLearned() const { return numConflictsLearned_; }
 };
 
 #endif
@@ -14,7 +14,10 @@
 #include "mip/HighsCutPool.h"
 
 #include <cassert>
+#include <iterator>
+#include <mutex>
 #include <numeric>
+#include <tuple>
 
 #include "mip/HighsDomain.h"
 #include "mip/HighsLpRelaxation.h"
@@ -91,35 +94,6 @@ bool HighsCutPool::isDuplicate(size_t hash, double norm, const HighsInt* Rindex,
   return false;
 }
 
-double HighsCutPool::getParallelism(HighsInt row1, HighsInt row2) const {
-  HighsInt i1 = matrix_.getRowStart(row1);
-  const HighsInt end1 = matrix_.getRowEnd(row1);
-
-  HighsInt i2 = matrix_.getRowStart(row2);
-  const HighsInt end2 = matrix_.getRowEnd(row2);
-
-  const HighsInt* ARindex = matrix_.getARindex();
-  const double* ARvalue = matrix_.getARvalue();
-
-  double dotprod = 0.0;
-  while (i1 != end1 && i2 != end2) {
-    HighsInt col1 = ARindex[i1];
-    HighsInt col2 = ARindex[i2];
-
-    if (col1 < col2)
-      ++i1;
-    else if (col2 < col1)
-      ++i2;
-    else {
-      dotprod += ARvalue[i1] * ARvalue[i2];
-      ++i1;
-      ++i2;
-    }
-  }
-
-  return dotprod * rownormalization_[row1] * rownormalization_[row2];
-}
-
 void HighsCutPool::lpCutRemoved(HighsInt cut) {
   if (matrix_.columnsLinked(cut)) {
     propRows.erase(std::make_pair(-1, cut));
@@ -131,6 +105,7 @@ void HighsCutPool::lpCutRemoved(HighsInt cut) {
 }
 
 void HighsCutPool::performAging() {
+  assert(!concurrentEpoch);
   HighsInt cutIndexEnd = matrix_.getNumRows();
 
   HighsInt agelim = agelim_;
@@ -320,17 +295,14 @@ void HighsCutPool::separate(const std::vector<double>& sol, HighsDomain& domain,
 
   assert(cutset.empty());
 
+  cutSelector.reset(sol.size());
   for (const std::pair<double, HighsInt>& p : efficacious_cuts) {
-    bool discard = false;
     double maxpar = 0.1;
-    for (HighsInt k : cutset.cutindices) {
-      if (getParallelism(k, p.second) > maxpar) {
-        discard = true;
-        break;
-      }
-    }
-
-    if (discard) continue;
+    HighsInt start = matrix_.getRowStart(p.second);
+    HighsInt len = matrix_.getRowEnd(p.second) - start;
+    if (!cutSelector.trySelect(&ARindex[start], &ARvalue[start], len,
+                               rownormalization_[p.second], maxpar))
+      continue;
 
     --ageDistribution[ages_[p.second]];
     ++numLpCuts;
@@ -413,6 +385,10 @@ HighsInt HighsCutPool::addCut(const HighsMipSolver& mipsolver, HighsInt* Rindex,
                               bool extractCliques, bool isConflict) {
   mipsolver.mipdata_->debugSolution.checkCut(Rindex, Rvalue, Rlen, rhs);
 
+  if (concurrentEpoch)
+    return addPendingCut(Rindex, Rvalue, Rlen, rhs, integral, propagate,
+                         extractCliques, isConflict);
+
   sortBuffer.resize(Rlen);
 
   // compute 1/||a|| for the cut
@@ -529,3 +505,82 @@ HighsInt HighsCutPool::addCut(const HighsMipSolver& mipsolver, HighsInt* Rindex,
 
   return rowindex;
 }
+
+HighsInt HighsCutPool::addPendingCut(HighsInt* Rindex, double* Rvalue,
+                                     HighsInt Rlen, double rhs, bool integral,
+                                     bool propagate, bool extractCliques,
+                                     bool isConflict) {
+  // the member sort buffer cannot be shared by concurrent tasks
+  std::vector<std::pair<HighsInt, double>> buffer(Rlen);
+  double norm = 0.0;
+  double maxabscoef = 0.0;
+  for (HighsInt i = 0; i != Rlen; ++i) {
+    norm += Rvalue[i] * Rvalue[i];
+    maxabscoef = std::max(maxabscoef, std::abs(Rvalue[i]));
+    buffer[i].first = Rindex[i];
+    buffer[i].second = Rvalue[i];
+  }
+  pdqsort_branchless(
+      buffer.begin(), buffer.end(),
+      [](const std::pair<HighsInt, double>& a,
+         const std::pair<HighsInt, double>& b) { return a.first < b.first; });
+  for (HighsInt i = 0; i != Rlen; ++i) {
+    Rindex[i] = buffer[i].first;
+    Rvalue[i] = buffer[i].second;
+  }
+  uint64_t h = compute_cut_hash(Rindex, Rvalue, maxabscoef, Rlen);
+  double normalization = 1.0 / double(sqrt(norm));
+
+  // the rows of the pool do not change during the epoch, so they are read
+  // without locking. Duplicates among the cuts of the epoch are only removed
+  // by commitPendingCuts(), since which of them arrives first depends on the
+  // scheduling of the tasks
+  if (isDuplicate(h, normalization, Rindex, Rvalue, Rlen, rhs)) return -1;
+
+  PendingCutShard& shard = pendingCutShards[h % kNumPendingCutShards];
+  std::lock_guard<HighsSpinMutex> lock(shard.mutex);
+  shard.cuts.push_back(PendingCut{h, normalization, rhs, integral, propagate,
+                                  extractCliques, isConflict,
+                                  std::vector<HighsInt>(Rindex, Rindex + Rlen),
+                                  std::vector<double>(Rvalue, Rvalue + Rlen)});
+  return kPendingCut;
+}
+
+HighsInt HighsCutPool::commitPendingCuts(const HighsMipSolver& mipsolver) {
+  concurrentEpoch = false;
+
+  std::vector<PendingCut> cuts;
+  for (HighsInt k = 0; k < kNumPendingCutShards; ++k) {
+    PendingCutShard& shard = pendingCutShards[k];
+    std::move(shard.cuts.begin(), shard.cuts.end(), std::back_inserter(cuts));
+    shard.cuts.clear();
+  }
+
+  // the order is total, and duplicates of each other have the same hash and
+  // are ordered by their normalized right hand side, so that addCut() keeps
+  // the tightest of them
+  pdqsort(cuts.begin(), cuts.end(),
+          [](const PendingCut& a, const PendingCut& b) {
+            if (a.hash != b.hash) return a.hash < b.hash;
+            double aRhs = a.rhs * a.normalization;
+            double bRhs = b.rhs * b.normalization;
+            if (aRhs != bRhs) return aRhs < bRhs;
+            if (a.index != b.index) return a.index < b.index;
+            if (a.value != b.value) return a.value < b.value;
+            return std::make_tuple(a.integral, a.propagate, a.extractCliques,
+                                   a.isConflict) <
+                   std::make_tuple(b.integral, b.propagate, b.extractCliques,
+                                   b.isConflict);
+          });
+
+  HighsInt numAdded = 0;
+  for (PendingCut& cut : cuts) {
+    HighsInt cutindex =
+        addCut(mipsolver, cut.index.data(), cut.value.data(), cut.index.size(),
+               cut.rhs, cut.integral, cut.propagate, cut.extractCliques,
+               cut.isConflict);
+    if (cutindex != -1) ++numAdded;
+  }
+
+  return numAdded;
+}
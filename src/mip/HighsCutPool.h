@@ -18,8 +18,10 @@
 #include <vector>
 
 #include "lp_data/HConst.h"
+#include "mip/HighsCutSelector.h"
 #include "mip/HighsDomain.h"
 #include "mip/HighsDynamicRowMatrix.h"
+#include "parallel/HighsSpinMutex.h"
 
 class HighsLpRelaxation;
 
@@ -76,10 +78,37 @@ class HighsCutPool {
   HighsInt numPropRows;
   std::vector<HighsInt> ageDistribution;
   std::vector<std::pair<HighsInt, double>> sortBuffer;
+  HighsCutSelector cutSelector;
+
+  // cuts that are added during a concurrent epoch are kept in shards
+  // selected by their hash, so that tasks adding different cuts rarely wait
+  // for each other
+  struct PendingCut {
+    uint64_t hash;
+    double normalization;
+    double rhs;
+    bool integral;
+    bool propagate;
+    bool extractCliques;
+    bool isConflict;
+    std::vector<HighsInt> index;
+    std::vector<double> value;
+  };
+  struct PendingCutShard {
+    HighsSpinMutex mutex;
+    std::vector<PendingCut> cuts;
+  };
+  enum { kNumPendingCutShards = 16 };
+  std::unique_ptr<PendingCutShard[]> pendingCutShards;
+  bool concurrentEpoch;
 
   bool isDuplicate(size_t hash, double norm, const HighsInt* Rindex,
                    const double* Rvalue, HighsInt Rlen, double rhs);
 
+  HighsInt addPendingCut(HighsInt* Rindex, double* Rvalue, HighsInt Rlen,
+                         double rhs, bool integral, bool propagate,
+                         bool extractCliques, bool isConflict);
+
  public:
   HighsCutPool(HighsInt ncols, HighsInt agelim, HighsInt softlimit)
       : matrix_(ncols),
@@ -87,7 +116,9 @@ class HighsCutPool {
         softlimit_(softlimit),
         numLpCuts(0),
         numPropNzs(0),
-        numPropRows(0) {
+        numPropRows(0),
+        pendingCutShards(new PendingCutShard[kNumPendingCutShards]),
+        concurrentEpoch(false) {
     ageDistribution.resize(agelim_ + 1);
     minScoreFactor = 0.9;
     bestObservedScore = 0.0;
@@ -109,8 +140,6 @@ class HighsCutPool {
     }
   }
 
-  double getParallelism(HighsInt row1, HighsInt row2) const;
-
   void performAging();
 
   void lpCutRemoved(HighsInt cut);
@@ -140,6 +169,8 @@ class HighsCutPool {
 
   bool cutIsIntegral(HighsInt cut) const { return rowintegral[cut]; }
 
+  bool cutIsInLp(HighsInt cut) const { return ages_[cut] < 0; }
+
   HighsInt getNumCuts() const {
     return matrix_.getNumRows() - matrix_.getNumDelRows();
   }
@@ -152,11 +183,38 @@ class HighsCutPool {
     return rownormalization_[cut];
   }
 
+  // Returned by addCut() for a cut that is added during a concurrent epoch
+  // and is not a duplicate of a cut in the pool. The cut has no index until
+  // commitPendingCuts(), which may still find it to duplicate another cut of
+  // the epoch, but callers are to treat it like an accepted cut, so that
+  // what they do next does not depend on the order of the tasks
+  static constexpr HighsInt kPendingCut = -2;
+
+  // Adds the cut to the pool and returns its index, or -1 if it is a
+  // duplicate of a cut in the pool. During a concurrent epoch the cut is
+  // only checked against the cuts of the pool before the epoch and kept
+  // until commitPendingCuts(), and kPendingCut is returned if it is not a
+  // duplicate
   HighsInt addCut(const HighsMipSolver& mipsolver, HighsInt* Rindex,
                   double* Rvalue, HighsInt Rlen, double rhs,
                   bool integral = false, bool propagate = true,
                   bool extractCliques = true, bool isConflict = false);
 
+  // Starts an epoch in which addCut() can be called from concurrent tasks.
+  // The rows of the pool are not changed until commitPendingCuts() ends
+  // the epoch, so that all reads of the pool during the epoch see the same
+  // snapshot. No other modification of the pool, such as aging, is allowed
+  // during the epoch
+  void beginConcurrentEpoch() { concurrentEpoch = true; }
+
+  bool inConcurrentEpoch() const { return concurrentEpoch; }
+
+  // Ends the concurrent epoch and adds the cuts of the epoch to the pool in
+  // an order that does not depend on the scheduling of the tasks, which
+  // keeps the tightest of the cuts of the epoch that duplicate each other.
+  // Returns the number of cuts that were added
+  HighsInt commitPendingCuts(const HighsMipSolver& mipsolver);
+
   HighsInt getRowLength(HighsInt row) const {
     return matrix_.getRowEnd(row) - matrix_.getRowStart(row);
   }
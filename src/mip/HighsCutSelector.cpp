@@ -0,0 +1,87 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "mip/HighsCutSelector.h"
+
+#include <algorithm>
+#include <cassert>
+
+void HighsCutSelector::reset(HighsInt numCol) {
+  // only the lists of columns that were used are cleared, so that a
+  // selection among few cuts does not need to touch every column
+  if ((HighsInt)colHead.size() != numCol)
+    colHead.assign(numCol, -1);
+  else
+    for (HighsInt col : usedCols) colHead[col] = -1;
+
+  usedCols.clear();
+  entryNext.clear();
+  entryCut.clear();
+  entryValue.clear();
+  cutNormalization.clear();
+}
+
+double HighsCutSelector::maxParallelism(const HighsInt* Rindex,
+                                        const double* Rvalue, HighsInt Rlen,
+                                        double normalization) {
+  dotProducts.resize(cutNormalization.size());
+  isOverlapping.resize(cutNormalization.size());
+  assert(overlappingCuts.empty());
+
+  for (HighsInt i = 0; i != Rlen; ++i) {
+    assert(Rindex[i] < (HighsInt)colHead.size());
+    for (HighsInt pos = colHead[Rindex[i]]; pos != -1; pos = entryNext[pos]) {
+      HighsInt cut = entryCut[pos];
+      if (!isOverlapping[cut]) {
+        isOverlapping[cut] = 1;
+        overlappingCuts.push_back(cut);
+      }
+      dotProducts[cut] += Rvalue[i] * entryValue[pos];
+    }
+  }
+
+  double maxPar = 0.0;
+  for (HighsInt cut : overlappingCuts) {
+    maxPar = std::max(maxPar, dotProducts[cut] * cutNormalization[cut]);
+    dotProducts[cut] = 0.0;
+    isOverlapping[cut] = 0;
+  }
+  overlappingCuts.clear();
+
+  return maxPar * normalization;
+}
+
+bool HighsCutSelector::trySelect(const HighsInt* Rindex, const double* Rvalue,
+                                 HighsInt Rlen, double normalization,
+                                 double maxPar) {
+  if (maxParallelism(Rindex, Rvalue, Rlen, normalization) > maxPar)
+    return false;
+
+  select(Rindex, Rvalue, Rlen, normalization);
+  return true;
+}
+
+void HighsCutSelector::select(const HighsInt* Rindex, const double* Rvalue,
+                              HighsInt Rlen, double normalization) {
+  HighsInt cut = cutNormalization.size();
+  cutNormalization.push_back(normalization);
+
+  for (HighsInt i = 0; i != Rlen; ++i) {
+    HighsInt col = Rindex[i];
+    if (colHead[col] == -1) usedCols.push_back(col);
+    entryNext.push_back(colHead[col]);
+    entryCut.push_back(cut);
+    entryValue.push_back(Rvalue[i]);
+    colHead[col] = entryNext.size() - 1;
+  }
+}
@@ -0,0 +1,66 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsCutSelector.h
+ * @brief greedy selection of cuts that are pairwise almost orthogonal
+ */
+#ifndef MIP_HIGHS_CUT_SELECTOR_H_
+#define MIP_HIGHS_CUT_SELECTOR_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "util/HighsInt.h"
+
+/// Selects cuts, offered in the order of decreasing score, whose parallelism
+/// to all previously selected cuts does not exceed a limit. The nonzeros of
+/// the selected cuts are stored column wise, so that the dot products of a
+/// candidate with all selected cuts are accumulated into a dense array in a
+/// single pass over the columns of the candidate instead of merging the
+/// candidate with each selected cut separately.
+class HighsCutSelector {
+  // column wise linked lists of the nonzeros of the selected cuts
+  std::vector<HighsInt> colHead;
+  std::vector<HighsInt> usedCols;
+  std::vector<HighsInt> entryNext;
+  std::vector<HighsInt> entryCut;
+  std::vector<double> entryValue;
+
+  // normalization of the selected cuts, i.e. the inverse of their norm
+  std::vector<double> cutNormalization;
+
+  // working memory for the dot products with the selected cuts
+  std::vector<double> dotProducts;
+  std::vector<uint8_t> isOverlapping;
+  std::vector<HighsInt> overlappingCuts;
+
+ public:
+  /// starts a new selection of cuts with column indices below numCol
+  void reset(HighsInt numCol);
+
+  /// returns the largest parallelism of the cut to a selected cut
+  double maxParallelism(const HighsInt* Rindex, const double* Rvalue,
+                        HighsInt Rlen, double normalization);
+
+  /// selects the cut if its parallelism to every selected cut is at most
+  /// maxPar and returns whether it was selected
+  bool trySelect(const HighsInt* Rindex, const double* Rvalue, HighsInt Rlen,
+                 double normalization, double maxPar);
+
+  /// adds the cut to the selected cuts without checking its parallelism
+  void select(const HighsInt* Rindex, const double* Rvalue, HighsInt Rlen,
+              double normalization);
+
+  HighsInt numSelected() const { return cutNormalization.size(); }
+};
+
+#endif
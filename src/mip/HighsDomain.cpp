@@ -312,7 +312,8 @@ void HighsDomain::ConflictPoolPropagation::propagateConflict(
       domain->infeasible_reason = Reason::cut(
           domain->cutpoolpropagation.size() + conflictpoolindex, conflict);
       domain->infeasible_pos = domain->domchgstack_.size();
-      conflictpool_->resetAge(conflict);
+      conflictpool_->conflictCutoff(conflict);
+      ++domain->mipsolver->mipdata_->num_conflict_cutoffs;
       // printf("conflict propagation found infeasibility\n");
       break;
     case 1: {
@@ -322,7 +323,8 @@ void HighsDomain::ConflictPoolPropagation::propagateConflict(
             domain->flip(entries[inactive[0]]),
             Reason::cut(domain->cutpoolpropagation.size() + conflictpoolindex,
                         conflict));
-        conflictpool_->resetAge(conflict);
+        conflictpool_->conflictPropagated(conflict);
+        ++domain->mipsolver->mipdata_->num_conflict_propagations;
       }
       // printf("conflict propagation found bound change\n");
       break;
@@ -1449,8 +1451,19 @@ HighsInt HighsDomain::propagateRowUpper(const HighsInt* Rindex,
                                         HighsDomainChange* boundchgs) {
   assert(std::isfinite(double(minactivity)));
   if (ninfmin > 1) return 0;
+  // with a finite minimal activity a column can only be tightened if its
+  // contribution ranges over more than the slack of the row
+  const double slack =
+      ninfmin == 0
+          ? Rupper - double(minactivity) - mipsolver->mipdata_->feastol
+          : -kHighsInf;
   HighsInt numchgs = 0;
   for (HighsInt i = 0; i != Rlen; ++i) {
+    if (std::fabs(Rvalue[i]) *
+            (col_upper_[Rindex[i]] - col_lower_[Rindex[i]]) <=
+        slack)
+      continue;
+
     HighsCDouble minresact;
     double actcontribution = activityContributionMin(
         Rvalue[i], col_lower_[Rindex[i]], col_upper_[Rindex[i]]);
@@ -1493,8 +1506,17 @@ HighsInt HighsDomain::propagateRowLower(const HighsInt* Rindex,
                                         HighsDomainChange* boundchgs) {
   assert(std::isfinite(double(maxactivity)));
   if (ninfmax > 1) return 0;
+  const double slack =
+      ninfmax == 0
+          ? double(maxactivity) - Rlower - mipsolver->mipdata_->feastol
+          : -kHighsInf;
   HighsInt numchgs = 0;
   for (HighsInt i = 0; i != Rlen; ++i) {
+    if (std::fabs(Rvalue[i]) *
+            (col_upper_[Rindex[i]] - col_lower_[Rindex[i]]) <=
+        slack)
+      continue;
+
     HighsCDouble maxresact;
     double actcontribution = activityContributionMax(
         Rvalue[i], col_lower_[Rindex[i]], col_upper_[Rindex[i]]);
@@ -2409,6 +2431,7 @@ bool HighsDomain::propagate() {
       auto& conflictprop = conflictPoolPropagation[conflictPool];
       while (!conflictprop.propagateConflictInds_.empty()) {
         propagateinds.swap(conflictprop.propagateConflictInds_);
+        mipsolver->mipdata_->propagation_steps += propagateinds.size();
 
         for (HighsInt conflict : propagateinds)
           conflictprop.propagateConflict(conflict);
@@ -2422,6 +2445,7 @@ bool HighsDomain::propagate() {
 
       HighsInt propnnz = 0;
       HighsInt numproprows = propagateinds.size();
+      mipsolver->mipdata_->propagation_steps += numproprows;
       for (HighsInt i = 0; i != numproprows; ++i) {
         HighsInt row = propagateinds[i];
         propagateflags_[row] = 0;
@@ -2515,6 +2539,7 @@ bool HighsDomain::propagate() {
 
         HighsInt propnnz = 0;
         HighsInt numproprows = propagateinds.size();
+        mipsolver->mipdata_->propagation_steps += numproprows;
 
         for (HighsInt i = 0; i != numproprows; ++i) {
           HighsInt cut = propagateinds[i];
@@ -2528,9 +2553,9 @@ bool HighsDomain::propagate() {
               numproprows, std::make_pair(HighsInt{0}, HighsInt{0}));
 
           auto propagateIndex = [&](HighsInt k) {
-            // first check if cut is marked as deleted
-            if (cutpoolprop.propagatecutflags_[k] & 2) return;
             HighsInt i = propagateinds[k];
+            // first check if cut is marked as deleted
+            if (cutpoolprop.propagatecutflags_[i] & 2) return;
 
             HighsInt Rlen;
             const HighsInt* Rindex;
@@ -3796,8 +3821,9 @@ HighsInt HighsDomain::ConflictSet::computeCuts(
   }
 
   // if the queue size is 1 then we have a resolvable UIP that is not the
-  // branch vertex
-  if (queueSize() == 1) {
+  // branch vertex. In first UIP mode only the conflict cut is learned.
+  if (queueSize() == 1 &&
+      !localdom.mipsolver->options_mip_->mip_conflict_first_uip) {
     LocalDomChg uip = *popQueue();
     clearQueue();
 
@@ -3870,6 +3896,8 @@ void HighsDomain::ConflictSet::conflictAnalysis(
     numConflicts += numNewConflicts;
     // if no conflict was found in the first non-empty depth level we stop here
     if (numConflicts == 0) break;
+    // in first UIP mode we stop after the first depth level with a conflict
+    if (localdom.mipsolver->options_mip_->mip_conflict_first_uip) break;
     // if no conflict was found in this depth level and all conflicts of the
     // first 5 non-empty depth levels are generated we stop here
     if (lastDepth - currDepth >= 4 && numNewConflicts == 0) break;
@@ -3880,7 +3908,7 @@ void HighsDomain::ConflictSet::conflictAnalysis(
   // means the bound change leading to infeasibility was the last branching
   // itself and hence should have been propagated in the previous depth but was
   // not, e.g. because the threshold for an integral variable was not reached.
-  if (currDepth == lastDepth)
+  if (currDepth == lastDepth && numConflicts == 0)
     conflictPool.addConflictCut(localdom, reasonSideFrontier);
 }
 
@@ -3945,6 +3973,8 @@ void HighsDomain::ConflictSet::conflictAnalysis(
     numConflicts += numNewConflicts;
     // if no conflict was found in the first non-empty depth level we stop here
     if (numConflicts == 0) break;
+    // in first UIP mode we stop after the first depth level with a conflict
+    if (localdom.mipsolver->options_mip_->mip_conflict_first_uip) break;
     // if no conflict was found in this depth level and all conflicts of the
     // first 5 non-empty depth levels are generated we stop here
     if (lastDepth - currDepth >= 4 && numNewConflicts == 0) break;
@@ -3955,6 +3985,6 @@ void HighsDomain::ConflictSet::conflictAnalysis(
   // means the bound change leading to infeasibility was the last branching
   // itself and hence should have been propagated in the previous depth but was
   // not, e.g. because the threshold for an integral variable was not reached.
-  if (currDepth == lastDepth)
+  if (currDepth == lastDepth && numConflicts == 0)
     conflictPool.addConflictCut(localdom, reasonSideFrontier);
 }
@@ -628,6 +628,8 @@ class HighsDomain {
   HighsInt numModelNonzeros() const { return mipsolver->numNonzero(); }
 
   bool inSubmip() const { return mipsolver->submip; }
+
+  const HighsMipSolver* getMipSolver() const { return mipsolver; }
 };
 
 #endif
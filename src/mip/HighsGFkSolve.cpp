@@ -109,3 +109,99 @@ void HighsGFkSolve::addNonzero(HighsInt row, HighsInt col, unsigned int val) {
 
   link(pos);
 }
+
+void HighsGFkSolve::gf2Factor(int numRhs) {
+  gf2NumWords = (numCol + numRhs + 63) >> 6;
+  gf2Rows.assign(size_t(numRow) * gf2NumWords, 0);
+
+  HighsInt numSlots = Avalue.size();
+  for (HighsInt pos = 0; pos != numSlots; ++pos) {
+    if ((Avalue[pos] & 1) == 0) continue;
+    gf2Rows[size_t(Arow[pos]) * gf2NumWords + (Acol[pos] >> 6)] |=
+        uint64_t{1} << (Acol[pos] & 63);
+  }
+
+  gf2RowSize.resize(numRow);
+  gf2UnusedRows.clear();
+  for (HighsInt row = 0; row != numRow; ++row) {
+    uint64_t* rowWords = gf2Rows.data() + size_t(row) * gf2NumWords;
+    for (int i = 0; i != numRhs; ++i) {
+      HighsInt bit = numCol + i;
+      if (rhs[numRhs * row + i] & 1)
+        rowWords[bit >> 6] |= uint64_t{1} << (bit & 63);
+    }
+
+    gf2RowSize[row] = 0;
+    for (HighsInt w = 0; w != gf2NumWords; ++w)
+      gf2RowSize[row] += gf2Popcount(rowWords[w]);
+    gf2UnusedRows.push_back(row);
+  }
+
+  // the columns are pivoted in the order of their initial number of nonzeros
+  // instead of the dynamic column sizes that the sparse elimination maintains,
+  // since the column counts of the dense rows are not kept up to date
+  std::vector<std::pair<HighsInt, HighsInt>> pivotOrder;
+  pivotOrder.reserve(numCol);
+  for (HighsInt col = 0; col != numCol; ++col)
+    if (colsize[col] != 0) pivotOrder.emplace_back(colsize[col], col);
+  std::sort(pivotOrder.begin(), pivotOrder.end());
+
+  HighsInt maxPivot = std::min(numRow, numCol);
+  factorColPerm.clear();
+  factorRowPerm.clear();
+  factorColPerm.reserve(maxPivot);
+  factorRowPerm.reserve(maxPivot);
+  colBasisStatus.assign(numCol, 0);
+  rowUsed.assign(numRow, 0);
+  HighsInt numPivot = 0;
+
+  for (const std::pair<HighsInt, HighsInt>& entry : pivotOrder) {
+    HighsInt pivotCol = entry.second;
+    HighsInt pivotWord = pivotCol >> 6;
+    uint64_t pivotMask = uint64_t{1} << (pivotCol & 63);
+
+    // choose the shortest unused row with a nonzero in the pivot column
+    HighsInt pivotPos = -1;
+    HighsInt pivotRowLen = kHighsIInf;
+    HighsInt numUnusedRows = gf2UnusedRows.size();
+    for (HighsInt i = 0; i != numUnusedRows; ++i) {
+      HighsInt row = gf2UnusedRows[i];
+      if ((gf2Rows[size_t(row) * gf2NumWords + pivotWord] & pivotMask) == 0)
+        continue;
+      if (gf2RowSize[row] < pivotRowLen) {
+        pivotRowLen = gf2RowSize[row];
+        pivotPos = i;
+      }
+    }
+
+    // the column is linearly dependent on the previous pivot columns
+    if (pivotPos == -1) continue;
+
+    HighsInt pivotRow = gf2UnusedRows[pivotPos];
+    gf2UnusedRows[pivotPos] = gf2UnusedRows.back();
+    gf2UnusedRows.pop_back();
+    --numUnusedRows;
+
+    const uint64_t* pivotRowWords =
+        gf2Rows.data() + size_t(pivotRow) * gf2NumWords;
+    for (HighsInt i = 0; i != numUnusedRows; ++i) {
+      HighsInt row = gf2UnusedRows[i];
+      uint64_t* rowWords = gf2Rows.data() + size_t(row) * gf2NumWords;
+      if ((rowWords[pivotWord] & pivotMask) == 0) continue;
+
+      HighsInt rowSize = 0;
+      for (HighsInt w = 0; w != gf2NumWords; ++w) {
+        rowWords[w] ^= pivotRowWords[w];
+        rowSize += gf2Popcount(rowWords[w]);
+      }
+      gf2RowSize[row] = rowSize;
+    }
+
+    ++numPivot;
+    factorColPerm.push_back(pivotCol);
+    factorRowPerm.push_back(pivotRow);
+    colBasisStatus[pivotCol] = 1;
+    rowUsed[pivotRow] = 1;
+    if (numPivot == maxPivot) break;
+  }
+}
@@ -19,11 +19,13 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <queue>
 #include <tuple>
 #include <vector>
 
 #include "lp_data/HConst.h"
+#include "util/HighsHash.h"
 
 // helper struct to compute the multipicative inverse by using fermats
 // theorem and recursive repeated squaring.
@@ -103,6 +105,37 @@ class HighsGFkSolve {
   std::priority_queue<HighsInt, std::vector<HighsInt>, std::greater<HighsInt>>
       freeslots;
 
+  // bit-packed dense copy of the system that is eliminated instead of the
+  // triplets for k = 2. Each row is stored in gf2NumWords consecutive 64 bit
+  // words holding the bits of the columns followed by the bits of the right
+  // hand sides, so that a row operation is an XOR of the words.
+  HighsInt gf2NumWords;
+  std::vector<uint64_t> gf2Rows;
+  std::vector<HighsInt> gf2RowSize;
+  std::vector<HighsInt> gf2UnusedRows;
+
+  static HighsInt gf2Popcount(uint64_t w) {
+    w = w - ((w >> 1) & uint64_t{0x5555555555555555});
+    w = (w & uint64_t{0x3333333333333333}) +
+        ((w >> 2) & uint64_t{0x3333333333333333});
+    w = (w + (w >> 4)) & uint64_t{0x0f0f0f0f0f0f0f0f};
+    return HighsInt((w * uint64_t{0x0101010101010101}) >> 56);
+  }
+
+  static HighsInt gf2LowestBit(uint64_t w) {
+    return HighsHashHelpers::log2i(w & (~w + 1));
+  }
+
+  bool gf2Bit(HighsInt row, HighsInt col) const {
+    return (gf2Rows[size_t(row) * gf2NumWords + (col >> 6)] >> (col & 63)) &
+           1;
+  }
+
+  // fills the dense rows from the triplets and the right hand sides and
+  // eliminates them. Sets up the factor permutations and the basis status of
+  // the columns like the sparse elimination does.
+  void gf2Factor(int numRhs);
+
   void link(HighsInt pos);
 
   void unlink(HighsInt pos);
@@ -132,6 +165,15 @@ class HighsGFkSolve {
   HighsInt numNonzeros() const { return int(Avalue.size() - freeslots.size()); }
   HighsInt findNonzero(HighsInt row, HighsInt col);
 
+  // maximal number of 64 bit words of the bit-packed system for which k = 2
+  // is solved densely. Larger systems use the sparse elimination.
+  static constexpr size_t kMaxGF2Words = size_t{1} << 20;
+
+  bool useGF2Dense(int numRhs) const {
+    size_t numWords = (size_t(numCol) + numRhs + 63) >> 6;
+    return numWords * numRow <= kMaxGF2Words;
+  }
+
   template <unsigned int k, int kNumRhs = 1, typename T>
   void fromCSC(const std::vector<T>& Aval, const std::vector<HighsInt>& Aindex,
                const std::vector<HighsInt>& Astart, HighsInt numRow) {
@@ -185,6 +227,11 @@ class HighsGFkSolve {
 
   template <unsigned int k, int kNumRhs = 1, typename ReportSolution>
   void solve(ReportSolution&& reportSolution) {
+    if (k == 2 && useGF2Dense(kNumRhs)) {
+      solveGF2<kNumRhs>(reportSolution);
+      return;
+    }
+
     auto cmpPrio = [](const std::pair<HighsInt, HighsInt>& a,
                       const std::pair<HighsInt, HighsInt>& b) {
       return a.first > b.first;
@@ -438,6 +485,112 @@ class HighsGFkSolve {
       }
     } while (performedBasisSwap);
   }
+
+  template <int kNumRhs = 1, typename ReportSolution>
+  void solveGF2(ReportSolution&& reportSolution) {
+    gf2Factor(kNumRhs);
+
+    // linearly dependent rows must have a zero right hand side for a solution
+    // to exist
+    bool hasSolution[kNumRhs];
+    HighsInt numRhsWithSolution = 0;
+    for (int rhsIndex = 0; rhsIndex < kNumRhs; ++rhsIndex) {
+      hasSolution[rhsIndex] = true;
+      for (HighsInt row : gf2UnusedRows) {
+        if (gf2Bit(row, numCol + rhsIndex)) {
+          hasSolution[rhsIndex] = false;
+          break;
+        }
+      }
+
+      numRhsWithSolution += hasSolution[rhsIndex];
+    }
+
+    if (numRhsWithSolution == 0) return;
+
+    std::vector<SolutionEntry> solution[kNumRhs];
+    std::vector<uint64_t> solutionBits[kNumRhs];
+    for (int rhsIndex = 0; rhsIndex < kNumRhs; ++rhsIndex) {
+      if (!hasSolution[rhsIndex]) continue;
+      solution[rhsIndex].reserve(numCol);
+      solutionBits[rhsIndex].resize(gf2NumWords);
+    }
+
+    HighsInt numFactorRows = factorRowPerm.size();
+
+    // as in the sparse case iterate one basic solution for each nonbasic
+    // column that has a nonzero in a row of the factor
+    std::vector<std::pair<HighsInt, HighsInt>> basisSwaps;
+    for (HighsInt i = numFactorRows - 1; i >= 0; --i) {
+      const uint64_t* rowWords =
+          gf2Rows.data() + size_t(factorRowPerm[i]) * gf2NumWords;
+      for (HighsInt w = 0; w != gf2NumWords; ++w) {
+        uint64_t word = rowWords[w];
+        while (word != 0) {
+          HighsInt col = (w << 6) + gf2LowestBit(word);
+          word &= word - 1;
+          if (col >= numCol) break;
+          if (colBasisStatus[col] != 0) continue;
+
+          colBasisStatus[col] = -1;
+          basisSwaps.emplace_back(i, col);
+        }
+      }
+    }
+
+    HighsInt basisSwapPos = 0;
+
+    bool performedBasisSwap;
+    do {
+      performedBasisSwap = false;
+
+      for (int rhsIndex = 0; rhsIndex < kNumRhs; ++rhsIndex) {
+        if (!hasSolution[rhsIndex]) continue;
+        solution[rhsIndex].clear();
+        std::fill(solutionBits[rhsIndex].begin(), solutionBits[rhsIndex].end(),
+                  0);
+      }
+
+      for (HighsInt i = numFactorRows - 1; i >= 0; --i) {
+        HighsInt row = factorRowPerm[i];
+        HighsInt col = factorColPerm[i];
+        assert(gf2Bit(row, col));
+        const uint64_t* rowWords = gf2Rows.data() + size_t(row) * gf2NumWords;
+
+        for (int rhsIndex = 0; rhsIndex < kNumRhs; ++rhsIndex) {
+          if (!hasSolution[rhsIndex]) continue;
+
+          // the parity of the row restricted to the columns with value one
+          // gives the row activity
+          uint64_t activity = 0;
+          const uint64_t* solWords = solutionBits[rhsIndex].data();
+          for (HighsInt w = 0; w != gf2NumWords; ++w)
+            activity ^= rowWords[w] & solWords[w];
+
+          if ((gf2Popcount(activity) & 1) == gf2Bit(row, numCol + rhsIndex))
+            continue;
+
+          solutionBits[rhsIndex][col >> 6] |= uint64_t{1} << (col & 63);
+          solution[rhsIndex].emplace_back(SolutionEntry{col, 1});
+        }
+      }
+
+      for (int rhsIndex = 0; rhsIndex < kNumRhs; ++rhsIndex)
+        if (hasSolution[rhsIndex]) reportSolution(solution[rhsIndex], rhsIndex);
+
+      if (basisSwapPos < (HighsInt)basisSwaps.size()) {
+        HighsInt basisIndex = basisSwaps[basisSwapPos].first;
+        HighsInt enteringCol = basisSwaps[basisSwapPos].second;
+        HighsInt leavingCol = factorColPerm[basisIndex];
+        assert(colBasisStatus[leavingCol] == 1);
+        factorColPerm[basisIndex] = enteringCol;
+        colBasisStatus[enteringCol] = 1;
+        colBasisStatus[leavingCol] = 0;
+        performedBasisSwap = true;
+        ++basisSwapPos;
+      }
+    } while (performedBasisSwap);
+  }
 };
 
 #endif
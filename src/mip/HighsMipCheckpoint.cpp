@@ -0,0 +1,339 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMipCheckpoint.cpp
+ * @brief
+ */
+#include "mip/HighsMipCheckpoint.h"
+
+#include <cstring>
+#include <fstream>
+
+#include "util/HighsBinaryIO.h"
+#include "util/HighsHash.h"
+
+// the file starts with the magic string, the version of the format and the
+// size of HighsInt, as the data is written in the native binary form
+static const char kMipCheckpointMagic[8] = {'H', 'i', 'G', 'H',
+                                            'S', 'M', 'C', 'P'};
+static const uint32_t kMipCheckpointVersion = 2;
+
+template <typename T>
+static uint64_t vectorHash(const std::vector<T>& values) {
+  return HighsHashHelpers::vector_hash(values.data(), values.size());
+}
+
+uint64_t mipCheckpointModelHash(const HighsLp& lp) {
+  std::vector<uint64_t> hashes{uint64_t(lp.num_col_),
+                               uint64_t(lp.num_row_),
+                               uint64_t(lp.sense_),
+                               HighsHashHelpers::hash(lp.offset_),
+                               vectorHash(lp.col_cost_),
+                               vectorHash(lp.col_lower_),
+                               vectorHash(lp.col_upper_),
+                               vectorHash(lp.row_lower_),
+                               vectorHash(lp.row_upper_),
+                               vectorHash(lp.a_matrix_.start_),
+                               vectorHash(lp.a_matrix_.index_),
+                               vectorHash(lp.a_matrix_.value_),
+                               vectorHash(lp.integrality_)};
+  return vectorHash(hashes);
+}
+
+static void writeModel(std::ostream& out, const HighsLp& lp) {
+  assert(lp.a_matrix_.isColwise());
+  highsBinaryWrite(out, lp.num_col_);
+  highsBinaryWrite(out, lp.num_row_);
+  highsBinaryWrite(out, lp.sense_);
+  highsBinaryWrite(out, lp.offset_);
+  highsBinaryWrite(out, lp.col_cost_);
+  highsBinaryWrite(out, lp.col_lower_);
+  highsBinaryWrite(out, lp.col_upper_);
+  highsBinaryWrite(out, lp.row_lower_);
+  highsBinaryWrite(out, lp.row_upper_);
+  highsBinaryWrite(out, lp.a_matrix_.start_);
+  highsBinaryWrite(out, lp.a_matrix_.index_);
+  highsBinaryWrite(out, lp.a_matrix_.value_);
+  highsBinaryWrite(out, lp.integrality_);
+}
+
+static bool readModel(std::istream& in, HighsLp& lp) {
+  lp.clear();
+  if (!highsBinaryRead(in, lp.num_col_) || !highsBinaryRead(in, lp.num_row_) ||
+      !highsBinaryRead(in, lp.sense_) || !highsBinaryRead(in, lp.offset_) ||
+      !highsBinaryRead(in, lp.col_cost_) ||
+      !highsBinaryRead(in, lp.col_lower_) ||
+      !highsBinaryRead(in, lp.col_upper_) ||
+      !highsBinaryRead(in, lp.row_lower_) ||
+      !highsBinaryRead(in, lp.row_upper_) ||
+      !highsBinaryRead(in, lp.a_matrix_.start_) ||
+      !highsBinaryRead(in, lp.a_matrix_.index_) ||
+      !highsBinaryRead(in, lp.a_matrix_.value_) ||
+      !highsBinaryRead(in, lp.integrality_))
+    return false;
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  lp.setMatrixDimensions();
+  return (HighsInt)lp.col_cost_.size() == lp.num_col_ &&
+         (HighsInt)lp.row_lower_.size() == lp.num_row_ &&
+         (HighsInt)lp.a_matrix_.start_.size() == lp.num_col_ + 1 &&
+         lp.a_matrix_.index_.size() == lp.a_matrix_.value_.size();
+}
+
+static void writePseudocost(std::ostream& out,
+                            const HighsPseudocostInitialization& pscost) {
+  highsBinaryWrite(out, pscost.pseudocostup);
+  highsBinaryWrite(out, pscost.pseudocostdown);
+  highsBinaryWrite(out, pscost.nsamplesup);
+  highsBinaryWrite(out, pscost.nsamplesdown);
+  highsBinaryWrite(out, pscost.inferencesup);
+  highsBinaryWrite(out, pscost.inferencesdown);
+  highsBinaryWrite(out, pscost.ninferencesup);
+  highsBinaryWrite(out, pscost.ninferencesdown);
+  highsBinaryWrite(out, pscost.conflictscoreup);
+  highsBinaryWrite(out, pscost.conflictscoredown);
+  highsBinaryWrite(out, pscost.cost_total);
+  highsBinaryWrite(out, pscost.inferences_total);
+  highsBinaryWrite(out, pscost.conflict_avg_score);
+  highsBinaryWrite(out, pscost.nsamplestotal);
+  highsBinaryWrite(out, pscost.ninferencestotal);
+}
+
+static bool readPseudocost(std::istream& in,
+                           HighsPseudocostInitialization& pscost) {
+  return highsBinaryRead(in, pscost.pseudocostup) &&
+         highsBinaryRead(in, pscost.pseudocostdown) &&
+         highsBinaryRead(in, pscost.nsamplesup) &&
+         highsBinaryRead(in, pscost.nsamplesdown) &&
+         highsBinaryRead(in, pscost.inferencesup) &&
+         highsBinaryRead(in, pscost.inferencesdown) &&
+         highsBinaryRead(in, pscost.ninferencesup) &&
+         highsBinaryRead(in, pscost.ninferencesdown) &&
+         highsBinaryRead(in, pscost.conflictscoreup) &&
+         highsBinaryRead(in, pscost.conflictscoredown) &&
+         highsBinaryRead(in, pscost.cost_total) &&
+         highsBinaryRead(in, pscost.inferences_total) &&
+         highsBinaryRead(in, pscost.conflict_avg_score) &&
+         highsBinaryRead(in, pscost.nsamplestotal) &&
+         highsBinaryRead(in, pscost.ninferencestotal);
+}
+
+// checks that all column indices refer to the presolved model, so that a
+// corrupted file is not used to index out of range
+static bool columnIndicesValid(const HighsMipCheckpoint& checkpoint) {
+  const HighsInt numCol = checkpoint.model.num_col_;
+  auto validCol = [&](HighsInt col) { return col >= 0 && col < numCol; };
+  auto validDomchgs = [&](const std::vector<HighsDomainChange>& domchgs) {
+    for (const HighsDomainChange& domchg : domchgs)
+      if (!validCol(domchg.column)) return false;
+    return true;
+  };
+
+  for (const HighsMipCheckpoint::Node& node : checkpoint.nodes) {
+    if (!validDomchgs(node.domchgstack)) return false;
+    for (HighsInt pos : node.branchings)
+      if (pos < 0 || pos >= (HighsInt)node.domchgstack.size()) return false;
+  }
+  if (!validDomchgs(checkpoint.conflict_entries)) return false;
+  for (HighsInt col : checkpoint.cut_index)
+    if (!validCol(col)) return false;
+  for (HighsInt var : checkpoint.clique_vars)
+    if (var < 0 || var >= 2 * numCol) return false;
+  for (const HighsMipCheckpoint::VarBound& vb : checkpoint.varbounds)
+    if (!validCol(vb.col) || !validCol(vb.vbcol)) return false;
+
+  const HighsInt numCutNz = checkpoint.cut_index.size();
+  const HighsInt numConflictNz = checkpoint.conflict_entries.size();
+  const HighsInt numCliqueNz = checkpoint.clique_vars.size();
+  auto validStarts = [](const std::vector<HighsInt>& starts, HighsInt nnz) {
+    for (size_t i = 0; i != starts.size(); ++i)
+      if (starts[i] < (i == 0 ? 0 : starts[i - 1]) || starts[i] > nnz)
+        return false;
+    return starts.empty() || starts.back() == nnz;
+  };
+  const size_t numCuts = checkpoint.cut_upper.size();
+  return checkpoint.cut_start.size() == numCuts + 1 &&
+         checkpoint.cut_integral.size() == numCuts &&
+         checkpoint.cut_value.size() == checkpoint.cut_index.size() &&
+         validStarts(checkpoint.cut_start, numCutNz) &&
+         validStarts(checkpoint.conflict_start, numConflictNz) &&
+         validStarts(checkpoint.clique_end, numCliqueNz) &&
+         checkpoint.clique_equality.size() == checkpoint.clique_end.size() &&
+         checkpoint.postsolve_stack.getOrigNumCol() == checkpoint.orig_num_col;
+}
+
+HighsStatus writeMipCheckpointFile(const HighsLogOptions& log_options,
+                                   const HighsMipCheckpoint& checkpoint,
+                                   const std::string& filename) {
+  std::ofstream out(filename, std::ios::out | std::ios::binary);
+  if (!out.is_open()) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "writeMipCheckpointFile: Cannot open writeable file \"%s\"\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
+
+  out.write(kMipCheckpointMagic, sizeof(kMipCheckpointMagic));
+  highsBinaryWrite(out, kMipCheckpointVersion);
+  highsBinaryWrite(out, uint8_t(sizeof(HighsInt)));
+
+  highsBinaryWrite(out, checkpoint.orig_num_col);
+  highsBinaryWrite(out, checkpoint.orig_num_row);
+  highsBinaryWrite(out, checkpoint.orig_model_hash);
+
+  writeModel(out, checkpoint.model);
+  checkpoint.postsolve_stack.write(out);
+
+  highsBinaryWrite(out, checkpoint.solution);
+  highsBinaryWrite(out, checkpoint.solution_objective);
+  highsBinaryWrite(out, checkpoint.bound_violation);
+  highsBinaryWrite(out, checkpoint.integrality_violation);
+  highsBinaryWrite(out, checkpoint.row_violation);
+
+  highsBinaryWrite(out, checkpoint.num_restarts);
+  highsBinaryWrite(out, checkpoint.pruned_treeweight);
+  highsBinaryWrite(out, checkpoint.num_nodes);
+  highsBinaryWrite(out, checkpoint.num_leaves);
+  highsBinaryWrite(out, checkpoint.total_lp_iterations);
+  highsBinaryWrite(out, checkpoint.heuristic_lp_iterations);
+  highsBinaryWrite(out, checkpoint.sepa_lp_iterations);
+  highsBinaryWrite(out, checkpoint.sb_lp_iterations);
+  highsBinaryWrite(out, checkpoint.propagation_steps);
+  highsBinaryWrite(out, checkpoint.separation_steps);
+  highsBinaryWrite(out, checkpoint.firstrootlpiters);
+  highsBinaryWrite(out, checkpoint.avgrootlpiters);
+
+  highsBinaryWrite(out, uint64_t(checkpoint.nodes.size()));
+  for (const HighsMipCheckpoint::Node& node : checkpoint.nodes) {
+    highsBinaryWrite(out, node.domchgstack);
+    highsBinaryWrite(out, node.branchings);
+    highsBinaryWrite(out, node.lower_bound);
+    highsBinaryWrite(out, node.estimate);
+    highsBinaryWrite(out, node.depth);
+  }
+  writePseudocost(out, checkpoint.pscost);
+
+  highsBinaryWrite(out, checkpoint.cut_start);
+  highsBinaryWrite(out, checkpoint.cut_index);
+  highsBinaryWrite(out, checkpoint.cut_value);
+  highsBinaryWrite(out, checkpoint.cut_upper);
+  highsBinaryWrite(out, checkpoint.cut_integral);
+
+  highsBinaryWrite(out, checkpoint.conflict_start);
+  highsBinaryWrite(out, checkpoint.conflict_entries);
+
+  highsBinaryWrite(out, checkpoint.clique_end);
+  highsBinaryWrite(out, checkpoint.clique_vars);
+  highsBinaryWrite(out, checkpoint.clique_equality);
+
+  highsBinaryWrite(out, checkpoint.varbounds);
+
+  if (!out) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "writeMipCheckpointFile: Error writing file \"%s\"\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
+  return HighsStatus::kOk;
+}
+
+HighsStatus readMipCheckpointFile(const HighsLogOptions& log_options,
+                                  HighsMipCheckpoint& checkpoint,
+                                  const std::string& filename) {
+  std::ifstream in(filename, std::ios::in | std::ios::binary);
+  if (!in.is_open()) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "readMipCheckpointFile: Cannot open readable file \"%s\"\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
+
+  char magic[sizeof(kMipCheckpointMagic)];
+  uint32_t version;
+  uint8_t intSize;
+  if (!in.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, kMipCheckpointMagic, sizeof(magic)) != 0 ||
+      !highsBinaryRead(in, version) || !highsBinaryRead(in, intSize)) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "readMipCheckpointFile: File \"%s\" is not a MIP checkpoint\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
+  if (version != kMipCheckpointVersion || intSize != sizeof(HighsInt)) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "readMipCheckpointFile: MIP checkpoint \"%s\" has version %u "
+                 "with %d-byte integers, expected version %u with %d-byte "
+                 "integers\n",
+                 filename.c_str(), version, int(intSize),
+                 kMipCheckpointVersion, int(sizeof(HighsInt)));
+    return HighsStatus::kError;
+  }
+
+  HighsMipCheckpoint read;
+  bool ok =
+      highsBinaryRead(in, read.orig_num_col) &&
+      highsBinaryRead(in, read.orig_num_row) &&
+      highsBinaryRead(in, read.orig_model_hash) &&
+      readModel(in, read.model) && read.postsolve_stack.read(in) &&
+      highsBinaryRead(in, read.solution) &&
+      highsBinaryRead(in, read.solution_objective) &&
+      highsBinaryRead(in, read.bound_violation) &&
+      highsBinaryRead(in, read.integrality_violation) &&
+      highsBinaryRead(in, read.row_violation) &&
+      highsBinaryRead(in, read.num_restarts) &&
+      highsBinaryRead(in, read.pruned_treeweight) &&
+      highsBinaryRead(in, read.num_nodes) &&
+      highsBinaryRead(in, read.num_leaves) &&
+      highsBinaryRead(in, read.total_lp_iterations) &&
+      highsBinaryRead(in, read.heuristic_lp_iterations) &&
+      highsBinaryRead(in, read.sepa_lp_iterations) &&
+      highsBinaryRead(in, read.sb_lp_iterations) &&
+      highsBinaryRead(in, read.propagation_steps) &&
+      highsBinaryRead(in, read.separation_steps) &&
+      highsBinaryRead(in, read.firstrootlpiters) &&
+      highsBinaryRead(in, read.avgrootlpiters);
+
+  uint64_t numNodes = 0;
+  ok = ok && highsBinaryRead(in, numNodes);
+  for (uint64_t i = 0; ok && i < numNodes; ++i) {
+    HighsMipCheckpoint::Node node;
+    ok = highsBinaryRead(in, node.domchgstack) &&
+         highsBinaryRead(in, node.branchings) &&
+         highsBinaryRead(in, node.lower_bound) &&
+         highsBinaryRead(in, node.estimate) && highsBinaryRead(in, node.depth);
+    if (ok) read.nodes.push_back(std::move(node));
+  }
+
+  ok = ok && readPseudocost(in, read.pscost) &&
+       highsBinaryRead(in, read.cut_start) &&
+       highsBinaryRead(in, read.cut_index) &&
+       highsBinaryRead(in, read.cut_value) &&
+       highsBinaryRead(in, read.cut_upper) &&
+       highsBinaryRead(in, read.cut_integral) &&
+       highsBinaryRead(in, read.conflict_start) &&
+       highsBinaryRead(in, read.conflict_entries) &&
+       highsBinaryRead(in, read.clique_end) &&
+       highsBinaryRead(in, read.clique_vars) &&
+       highsBinaryRead(in, read.clique_equality) &&
+       highsBinaryRead(in, read.varbounds) && columnIndicesValid(read);
+
+  if (!ok) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "readMipCheckpointFile: MIP checkpoint \"%s\" is truncated or "
+                 "corrupted\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
+
+  read.valid = true;
+  checkpoint = std::move(read);
+  return HighsStatus::kOk;
+}
@@ -0,0 +1,116 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMipCheckpoint.h
+ * @brief State of an interrupted branch-and-bound search, from which the MIP
+ * solver resumes the search without presolving and processing the root node
+ * again
+ */
+#ifndef MIP_HIGHS_MIP_CHECKPOINT_H_
+#define MIP_HIGHS_MIP_CHECKPOINT_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "io/HighsIO.h"
+#include "lp_data/HighsLp.h"
+#include "mip/HighsDomainChange.h"
+#include "mip/HighsPseudocost.h"
+#include "presolve/HighsPostsolveStack.h"
+
+struct HighsMipCheckpoint {
+  struct Node {
+    std::vector<HighsDomainChange> domchgstack;
+    std::vector<HighsInt> branchings;
+    double lower_bound;
+    double estimate;
+    HighsInt depth;
+  };
+
+  struct VarBound {
+    HighsInt col;
+    HighsInt vbcol;
+    double coef;
+    double constant;
+    bool upper;
+  };
+
+  bool valid = false;
+
+  // identifies the model given to the MIP solver
+  HighsInt orig_num_col = 0;
+  HighsInt orig_num_row = 0;
+  uint64_t orig_model_hash = 0;
+
+  // presolved model with the global bounds of the search
+  HighsLp model;
+  presolve::HighsPostsolveStack postsolve_stack;
+
+  // incumbent in the space of the original model
+  std::vector<double> solution;
+  double solution_objective = kHighsInf;
+  double bound_violation = 0;
+  double integrality_violation = 0;
+  double row_violation = 0;
+
+  // progress of the search
+  HighsInt num_restarts = 0;
+  double pruned_treeweight = 0;
+  int64_t num_nodes = 0;
+  int64_t num_leaves = 0;
+  int64_t total_lp_iterations = 0;
+  int64_t heuristic_lp_iterations = 0;
+  int64_t sepa_lp_iterations = 0;
+  int64_t sb_lp_iterations = 0;
+  int64_t propagation_steps = 0;
+  int64_t separation_steps = 0;
+  int64_t firstrootlpiters = 0;
+  double avgrootlpiters = 0;
+
+  // the remaining data is given for the presolved model, except for the
+  // pseudocosts which are given for the original model as they are after a
+  // restart
+  std::vector<Node> nodes;
+  HighsPseudocostInitialization pscost;
+
+  std::vector<HighsInt> cut_start;
+  std::vector<HighsInt> cut_index;
+  std::vector<double> cut_value;
+  std::vector<double> cut_upper;
+  std::vector<uint8_t> cut_integral;
+
+  std::vector<HighsInt> conflict_start;
+  std::vector<HighsDomainChange> conflict_entries;
+
+  // cliques are given by the indices 2 * col + val of their variables
+  std::vector<HighsInt> clique_end;
+  std::vector<HighsInt> clique_vars;
+  std::vector<uint8_t> clique_equality;
+
+  std::vector<VarBound> varbounds;
+
+  void clear() { *this = HighsMipCheckpoint(); }
+};
+
+// hash of the data of a model that identifies the model of a checkpoint
+uint64_t mipCheckpointModelHash(const HighsLp& lp);
+
+HighsStatus writeMipCheckpointFile(const HighsLogOptions& log_options,
+                                   const HighsMipCheckpoint& checkpoint,
+                                   const std::string& filename);
+
+HighsStatus readMipCheckpointFile(const HighsLogOptions& log_options,
+                                  HighsMipCheckpoint& checkpoint,
+                                  const std::string& filename);
+
+#endif
@@ -0,0 +1,121 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "mip/HighsMipSolutionPool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numeric>
+
+#include "util/HighsHash.h"
+
+void HighsMipSolutionPool::setup(HighsInt capacity) {
+  this->capacity = capacity;
+  entries.clear();
+}
+
+uint64_t HighsMipSolutionPool::computeHash(
+    const std::vector<double>& col_value,
+    const std::vector<HighsVarType>& integrality) {
+  integerValues.clear();
+  HighsInt numCol = col_value.size();
+  for (HighsInt i = 0; i != numCol; ++i)
+    if (integrality[i] == HighsVarType::kInteger)
+      integerValues.push_back(int64_t(std::round(col_value[i])));
+
+  return HighsHashHelpers::vector_hash(integerValues.data(),
+                                       integerValues.size());
+}
+
+bool HighsMipSolutionPool::sameIntegerValues(
+    const std::vector<double>& col_value1,
+    const std::vector<double>& col_value2,
+    const std::vector<HighsVarType>& integrality) const {
+  HighsInt numCol = col_value1.size();
+  for (HighsInt i = 0; i != numCol; ++i) {
+    if (integrality[i] != HighsVarType::kInteger) continue;
+    if (std::round(col_value1[i]) != std::round(col_value2[i])) return false;
+  }
+
+  return true;
+}
+
+HighsInt HighsMipSolutionPool::worstEntry() const {
+  assert(!entries.empty());
+  HighsInt worst = 0;
+  HighsInt numEntries = entries.size();
+  for (HighsInt i = 1; i != numEntries; ++i)
+    if (entries[i].rank > entries[worst].rank) worst = i;
+
+  return worst;
+}
+
+bool HighsMipSolutionPool::accepts(double rank) const {
+  if (capacity == 0) return false;
+  if ((HighsInt)entries.size() < capacity) return true;
+
+  return rank < entries[worstEntry()].rank;
+}
+
+double HighsMipSolutionPool::cutoff() const {
+  if (capacity == 0 || (HighsInt)entries.size() < capacity) return kHighsInf;
+
+  return entries[worstEntry()].rank;
+}
+
+bool HighsMipSolutionPool::addSolution(
+    const std::vector<double>& col_value, double objective, double rank,
+    const std::vector<HighsVarType>& integrality) {
+  if (!accepts(rank)) return false;
+
+  assert(col_value.size() == integrality.size());
+  uint64_t hash = computeHash(col_value, integrality);
+
+  for (Entry& entry : entries) {
+    if (entry.hash != hash ||
+        !sameIntegerValues(col_value, entry.solution.col_value, integrality))
+      continue;
+
+    // a solution with the same integer values is only replaced by a better
+    // one
+    if (rank >= entry.rank) return false;
+
+    entry.rank = rank;
+    entry.solution.objective = objective;
+    entry.solution.col_value = col_value;
+    return true;
+  }
+
+  Entry entry{rank, hash, HighsMipPoolSolution{objective, col_value}};
+  if ((HighsInt)entries.size() < capacity)
+    entries.push_back(std::move(entry));
+  else
+    entries[worstEntry()] = std::move(entry);
+
+  return true;
+}
+
+std::vector<HighsMipPoolSolution> HighsMipSolutionPool::getSolutions() const {
+  std::vector<HighsInt> order(entries.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](HighsInt i, HighsInt j) {
+    return entries[i].rank < entries[j].rank;
+  });
+
+  std::vector<HighsMipPoolSolution> solutions;
+  solutions.reserve(entries.size());
+  for (HighsInt i : order) solutions.push_back(entries[i].solution);
+
+  return solutions;
+}
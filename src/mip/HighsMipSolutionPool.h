@@ -0,0 +1,80 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMipSolutionPool.h
+ * @brief Bounded pool of the best distinct feasible solutions found by the MIP
+ * solver
+ */
+#ifndef MIP_HIGHS_MIP_SOLUTION_POOL_H_
+#define MIP_HIGHS_MIP_SOLUTION_POOL_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "lp_data/HConst.h"
+#include "util/HighsInt.h"
+
+struct HighsMipPoolSolution {
+  double objective;
+  std::vector<double> col_value;
+};
+
+/// Keeps the feasible solutions of the original model with the best
+/// objective values, up to a given number. Two solutions are considered
+/// equal if they agree in the values of all integer columns, in which case
+/// only the better one is kept. The solutions are ranked by their objective
+/// value in the minimization form of the original model.
+class HighsMipSolutionPool {
+  struct Entry {
+    double rank;
+    uint64_t hash;
+    HighsMipPoolSolution solution;
+  };
+
+  std::vector<Entry> entries;
+  std::vector<int64_t> integerValues;
+  HighsInt capacity = 0;
+
+  uint64_t computeHash(const std::vector<double>& col_value,
+                       const std::vector<HighsVarType>& integrality);
+
+  bool sameIntegerValues(const std::vector<double>& col_value1,
+                         const std::vector<double>& col_value2,
+                         const std::vector<HighsVarType>& integrality) const;
+
+  HighsInt worstEntry() const;
+
+ public:
+  /// clears the pool and sets the number of solutions that are kept
+  void setup(HighsInt capacity);
+
+  bool enabled() const { return capacity != 0; }
+
+  /// returns whether a solution with the given rank could enter the pool
+  bool accepts(double rank) const;
+
+  /// returns the rank of the worst solution if the pool is full, and
+  /// infinity otherwise. Only solutions of a smaller rank can enter the pool
+  double cutoff() const;
+
+  /// adds the solution if it is among the best distinct solutions and returns
+  /// whether it was added
+  bool addSolution(const std::vector<double>& col_value, double objective,
+                   double rank, const std::vector<HighsVarType>& integrality);
+
+  HighsInt numSolutions() const { return entries.size(); }
+
+  /// returns the solutions in the order of increasing rank
+  std::vector<HighsMipPoolSolution> getSolutions() const;
+};
+
+#endif
@@ -20,6 +20,7 @@
 #include "mip/HighsImplications.h"
 #include "mip/HighsLpRelaxation.h"
 #include "mip/HighsMipSolverData.h"
+#include "mip/HighsMipTrace.h"
 #include "mip/HighsPseudocost.h"
 #include "mip/HighsSearch.h"
 #include "mip/HighsSeparation.h"
@@ -41,7 +42,8 @@ HighsMipSolver::HighsMipSolver(const HighsOptions& options, const HighsLp& lp,
       rootbasis(nullptr),
       pscostinit(nullptr),
       clqtableinit(nullptr),
-      implicinit(nullptr) {
+      implicinit(nullptr),
+      checkpoint(nullptr) {
   if (solution.value_valid) {
     bound_violation_ = 0;
     row_violation_ = 0;
@@ -100,9 +102,34 @@ void HighsMipSolver::run() {
   // std::cout << options_mip_->presolve << std::endl;
   timer_.start(timer_.solve_clock);
 
+  if (!submip) solutionPool.setup(options_mip_->mip_solution_pool_size);
+
   mipdata_ = decltype(mipdata_)(new HighsMipSolverData(*this));
   mipdata_->init();
-  mipdata_->runPresolve();
+
+  if (!submip && !options_mip_->mip_trace_file.empty()) {
+    trace = HighsMipTrace::open(options_mip_->mip_trace_file);
+    if (!trace)
+      highsLogUser(options_mip_->log_options, HighsLogType::kWarning,
+                   "Cannot open MIP trace file %s\n",
+                   options_mip_->mip_trace_file.c_str());
+  }
+
+  bool resume = false;
+  if (!submip && checkpoint != nullptr && checkpoint->valid) {
+    resume =
+        checkpoint->orig_num_col == orig_model_->num_col_ &&
+        checkpoint->orig_num_row == orig_model_->num_row_ &&
+        checkpoint->orig_model_hash == mipCheckpointModelHash(*orig_model_);
+    if (!resume)
+      highsLogUser(options_mip_->log_options, HighsLogType::kWarning,
+                   "MIP checkpoint does not match the model and is ignored\n");
+  }
+
+  if (resume)
+    mipdata_->restoreCheckpoint(*checkpoint);
+  else
+    mipdata_->runPresolve();
   if (modelstatus_ != HighsModelStatus::kNotset) {
     highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
                  "Presolve: %s\n",
@@ -117,16 +144,27 @@ void HighsMipSolver::run() {
   }
 
   mipdata_->runSetup();
+  if (resume) pscostinit = nullptr;
 restart:
+  mipdata_->heuristics.allowBackgroundSubMips(false);
   if (modelstatus_ == HighsModelStatus::kNotset) {
-    mipdata_->evaluateRootNode();
-    // age 5 times to remove stored but never violated cuts after root
-    // separation
-    mipdata_->cutpool.performAging();
-    mipdata_->cutpool.performAging();
-    mipdata_->cutpool.performAging();
-    mipdata_->cutpool.performAging();
-    mipdata_->cutpool.performAging();
+    if (resume) {
+      mipdata_->resumeSearch(*checkpoint);
+      resume = false;
+    } else {
+      if (!submip && options_mip_->mip_root_racers > 1 &&
+          mipdata_->numRestarts == 0)
+        mipdata_->raceRootNode();
+      else
+        mipdata_->evaluateRootNode();
+      // age 5 times to remove stored but never violated cuts after root
+      // separation
+      mipdata_->cutpool.performAging();
+      mipdata_->cutpool.performAging();
+      mipdata_->cutpool.performAging();
+      mipdata_->cutpool.performAging();
+      mipdata_->cutpool.performAging();
+    }
   }
   if (mipdata_->nodequeue.empty()) {
     cleanupSolve();
@@ -144,7 +182,8 @@ restart:
   mipdata_->lower_bound = mipdata_->nodequeue.getBestLowerBound();
 
   mipdata_->printDisplayLine();
-  search.installNode(mipdata_->nodequeue.popBestBoundNode());
+  search.installNode(mipdata_->nodequeue.popBestBoundNode(),
+                     HighsMipTrace::NodeSelection::kBestBound);
   int64_t numStallNodes = 0;
   int64_t lastLbLeave = 0;
   int64_t numQueueLeaves = 0;
@@ -154,6 +193,8 @@ restart:
   double treeweightLastCheck = 0.0;
   double upperLimLastCheck = mipdata_->upper_limit;
   double lowerBoundLastCheck = mipdata_->lower_bound;
+  mipdata_->heuristics.allowBackgroundSubMips(
+      !submip && options_mip_->mip_background_heuristics);
   while (search.hasNode()) {
     mipdata_->conflictPool.performAging();
     // set iteration limit for each lp solve during the dive to 10 times the
@@ -186,10 +227,24 @@ restart:
           if (mipdata_->incumbent.empty())
             mipdata_->heuristics.RENS(
                 mipdata_->lp.getLpSolver().getSolution().col_value);
-          else
+          else {
+            HighsInt numImprovingSols = mipdata_->numImprovingSols;
             mipdata_->heuristics.RINS(
                 mipdata_->lp.getLpSolver().getSolution().col_value);
 
+            // the improvement heuristics only run if RINS did not find a
+            // better solution, which is not known while its sub-MIP is
+            // solved in the background
+            if (!submip && options_mip_->mip_improvement_heuristics &&
+                !mipdata_->heuristics.backgroundSubMipPending() &&
+                mipdata_->numImprovingSols == numImprovingSols) {
+              mipdata_->heuristics.localBranching();
+              if (!mipdata_->heuristics.backgroundSubMipPending() &&
+                  mipdata_->numImprovingSols == numImprovingSols)
+                mipdata_->heuristics.proximitySearch();
+            }
+          }
+
           mipdata_->heuristics.flushStatistics();
         }
       }
@@ -228,6 +283,7 @@ restart:
     }
     search.openNodesToQueue(mipdata_->nodequeue);
     search.flushStatistics();
+    mipdata_->heuristics.collectBackgroundSubMip(false);
 
     if (limit_reached) {
       mipdata_->lower_bound = std::min(mipdata_->upper_bound,
@@ -355,7 +411,8 @@ restart:
       assert(!search.hasNode());
 
       if (numQueueLeaves - lastLbLeave >= 10) {
-        search.installNode(mipdata_->nodequeue.popBestBoundNode());
+        search.installNode(mipdata_->nodequeue.popBestBoundNode(),
+                           HighsMipTrace::NodeSelection::kBestBound);
         lastLbLeave = numQueueLeaves;
       } else {
         HighsInt bestBoundNodeStackSize =
@@ -365,7 +422,8 @@ restart:
         if (nextNode.lower_bound == bestBoundNodeLb &&
             nextNode.domchgstack.size() == bestBoundNodeStackSize)
           lastLbLeave = numQueueLeaves;
-        search.installNode(std::move(nextNode));
+        search.installNode(std::move(nextNode),
+                           HighsMipTrace::NodeSelection::kBestEstimate);
       }
 
       ++numQueueLeaves;
@@ -386,8 +444,11 @@ restart:
       // we evaluate the node directly here instead of performing a dive
       // because we first want to check if the node is not fathomed due to
       // new global information before we perform separation rounds for the node
-      if (search.evaluateNode() == HighsSearch::NodeResult::kSubOptimal)
+      HighsSearch::NodeResult result = search.evaluateNode();
+      if (result == HighsSearch::NodeResult::kSubOptimal)
         search.currentNodeToQueue(mipdata_->nodequeue);
+      else if (search.currentNodePruned())
+        search.traceNode(result);
 
       // if the node was pruned we remove it from the search and install the
       // next node from the queue
@@ -469,10 +530,28 @@ restart:
     if (limit_reached) break;
   }
 
+  // a node that is still installed when a limit is reached belongs to the
+  // open nodes of the checkpoint
+  if (checkpoint != nullptr && !submip && options_mip_->mip_keep_checkpoint &&
+      search.hasNode()) {
+    search.openNodesToQueue(mipdata_->nodequeue);
+    search.flushStatistics();
+  }
+
   cleanupSolve();
 }
 
 void HighsMipSolver::cleanupSolve() {
+  mipdata_->heuristics.collectBackgroundSubMip(true, true);
+  // keep the state of the search if it stopped with open nodes and this is
+  // requested, and invalidate the checkpoint otherwise, so that a checkpoint
+  // is resumed at most once unless it is kept
+  if (checkpoint != nullptr && !submip) {
+    if (options_mip_->mip_keep_checkpoint)
+      mipdata_->saveCheckpoint(*checkpoint);
+    else
+      checkpoint->clear();
+  }
   timer_.start(timer_.postsolve_clock);
   bool havesolution = solution_objective_ != kHighsInf;
   bool feasible;
@@ -589,7 +668,10 @@ void HighsMipSolver::cleanupSolve() {
                "  LP iterations     %llu (total)\n"
                "                    %llu (strong br.)\n"
                "                    %llu (separation)\n"
-               "                    %llu (heuristics)\n",
+               "                    %llu (heuristics)\n"
+               "  Work units        %.0f\n"
+               "  Conflicts         %llu (propagations)\n"
+               "                    %llu (cutoffs)\n",
                timer_.read(timer_.solve_clock),
                timer_.read(timer_.presolve_clock),
                timer_.read(timer_.postsolve_clock),
@@ -597,7 +679,36 @@ void HighsMipSolver::cleanupSolve() {
                (long long unsigned)mipdata_->total_lp_iterations,
                (long long unsigned)mipdata_->sb_lp_iterations,
                (long long unsigned)mipdata_->sepa_lp_iterations,
-               (long long unsigned)mipdata_->heuristic_lp_iterations);
+               (long long unsigned)mipdata_->heuristic_lp_iterations,
+               mipdata_->workUnits(),
+               (long long unsigned)mipdata_->num_conflict_propagations,
+               (long long unsigned)mipdata_->num_conflict_cutoffs);
+  highsLogDev(options_mip_->log_options, HighsLogType::kInfo,
+              "  Restarts          %d\n"
+              "  Symmetry nodes    %llu\n"
+              "  Root racers       %llu (cuts)\n"
+              "                    %llu (solutions)\n"
+              "                    %llu (root bounds)\n"
+              "  Spilled nodes     %llu (written)\n"
+              "                    %llu (reloaded)\n"
+              "  Parallel cuts     %llu\n"
+              "  Sub-MIPs          %llu (background)\n"
+              "                    %llu (improvement)\n"
+              "                    %llu (improving sols.)\n"
+              "  Conflicts learned %llu\n",
+              int(mipdata_->numRestarts),
+              (long long unsigned)mipdata_->num_symmetry_nodes,
+              (long long unsigned)mipdata_->num_racer_cuts,
+              (long long unsigned)mipdata_->num_racer_solutions,
+              (long long unsigned)mipdata_->num_racer_root_bounds,
+              (long long unsigned)mipdata_->nodequeue.getNumNodesSpilled(),
+              (long long unsigned)mipdata_->nodequeue.getNumNodesReloaded(),
+              (long long unsigned)mipdata_->num_parallel_separation_cuts,
+              (long long unsigned)mipdata_->num_background_sub_mips,
+              (long long unsigned)mipdata_->num_improvement_sub_mips,
+              (long long unsigned)mipdata_->num_improvement_heuristic_sols,
+              (long long unsigned)
+                  mipdata_->conflictPool.getNumConflictsLearned());
 
   assert(modelstatus_ != HighsModelStatus::kNotset);
 }
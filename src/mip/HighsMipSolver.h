@@ -21,6 +21,8 @@ class HighsCutPool;
 struct HighsPseudocostInitialization;
 class HighsCliqueTable;
 class HighsImplications;
+struct HighsMipCheckpoint;
+class HighsMipTrace;
 
 class HighsMipSolver {
  public:
@@ -43,6 +45,15 @@ class HighsMipSolver {
   const HighsPseudocostInitialization* pscostinit;
   const HighsCliqueTable* clqtableinit;
   const HighsImplications* implicinit;
+  // checkpoint from which the search is resumed if it is valid for the
+  // model, and which receives the state of the search if it stops with open
+  // nodes
+  HighsMipCheckpoint* checkpoint;
+  // trace that receives a record for each node of the search
+  std::unique_ptr<HighsMipTrace> trace;
+  // best distinct feasible solutions of the original model, only kept by the
+  // MIP solver that is not a sub-MIP
+  HighsMipSolutionPool solutionPool;
 
   std::unique_ptr<HighsMipSolverData> mipdata_;
 
@@ -153,6 +153,8 @@ void HighsMipSolverData::startSymmetryDetection(
       mipsolver.mipdata_->presolvedModel,
       mipsolver.options_mip_->small_matrix_value);
   detectSymmetries = symData->symDetection.initializeDetection();
+  symData->symDetection.setMaxNumNodes(
+      mipsolver.options_mip_->mip_symmetry_max_nodes);
 
   if (detectSymmetries) {
     taskGroup.spawn([&]() {
@@ -173,6 +175,7 @@ void HighsMipSolverData::finishSymmetryDetection(
   taskGroup.sync();
 
   symmetries = std::move(symData->symmetries);
+  num_symmetry_nodes += symData->symDetection.getNumNodes();
   highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
                "\nSymmetry detection completed in %.1fs\n",
                symData->detectionTime);
@@ -253,6 +256,26 @@ double HighsMipSolverData::computeNewUpperLimit(double ub, double mip_abs_gap,
   return new_upper_limit;
 }
 
+bool HighsMipSolverData::updateUpperLimit() {
+  // with a solution pool the search needs to find all solutions that can
+  // still enter the pool, so the limits are derived from the worst solution
+  // in a full pool instead of the incumbent
+  double ub = upper_bound;
+  if (mipsolver.solutionPool.enabled())
+    ub = mipsolver.solutionPool.cutoff() - mipsolver.model_->offset_;
+  if (ub == kHighsInf) return false;
+
+  double new_upper_limit = computeNewUpperLimit(ub, 0.0, 0.0);
+  if (new_upper_limit >= upper_limit) return false;
+
+  upper_limit = new_upper_limit;
+  optimality_limit =
+      computeNewUpperLimit(ub, mipsolver.options_mip_->mip_abs_gap,
+                           mipsolver.options_mip_->mip_rel_gap);
+  nodequeue.setOptimalityLimit(optimality_limit);
+  return true;
+}
+
 bool HighsMipSolverData::moreHeuristicsAllowed() {
   // in the beginning of the search and in sub-MIP heuristics we only allow
   // what is proportionally for the currently spent effort plus an initial
@@ -374,6 +397,18 @@ void HighsMipSolverData::init() {
   heuristic_lp_iterations_before_run = 0;
   sepa_lp_iterations_before_run = 0;
   sb_lp_iterations_before_run = 0;
+  propagation_steps = 0;
+  separation_steps = 0;
+  num_conflict_propagations = 0;
+  num_conflict_cutoffs = 0;
+  num_symmetry_nodes = 0;
+  num_racer_cuts = 0;
+  num_racer_solutions = 0;
+  num_racer_root_bounds = 0;
+  num_parallel_separation_cuts = 0;
+  num_background_sub_mips = 0;
+  num_improvement_sub_mips = 0;
+  num_improvement_heuristic_sols = 0;
   num_disp_lines = 0;
   numCliqueEntriesAfterPresolve = 0;
   numCliqueEntriesAfterFirstPresolve = 0;
@@ -443,14 +478,12 @@ void HighsMipSolverData::runSetup() {
     }
     if (feasible && solobj < upper_bound) {
       upper_bound = solobj;
-      double new_upper_limit = computeNewUpperLimit(solobj, 0.0, 0.0);
-      if (new_upper_limit < upper_limit) {
-        upper_limit = new_upper_limit;
-        optimality_limit =
-            computeNewUpperLimit(solobj, mipsolver.options_mip_->mip_abs_gap,
-                                 mipsolver.options_mip_->mip_rel_gap);
-        nodequeue.setOptimalityLimit(optimality_limit);
-      }
+      if (!mipsolver.submip)
+        mipsolver.solutionPool.addSolution(
+            mipsolver.solution_, mipsolver.solution_objective_,
+            solobj + mipsolver.model_->offset_,
+            mipsolver.orig_model_->integrality_);
+      updateUpperLimit();
     }
   }
 
@@ -460,6 +493,8 @@ void HighsMipSolverData::runSetup() {
   pseudocost = HighsPseudocost(mipsolver);
   nodequeue.setNumCol(mipsolver.numCol());
   nodequeue.setOptimalityLimit(optimality_limit);
+  nodequeue.setMemoryLimit(mipsolver.options_mip_->mip_node_memory_limit *
+                           1024 * 1024);
 
   continuous_cols.clear();
   integer_cols.clear();
@@ -647,22 +682,12 @@ void HighsMipSolverData::runSetup() {
                  "\n");
 }
 
-double HighsMipSolverData::transformNewIncumbent(
-    const std::vector<double>& sol) {
-  HighsSolution solution;
-  solution.col_value = sol;
-  calculateRowValuesQuad(*mipsolver.orig_model_, solution);
-  solution.value_valid = true;
-
-  postSolveStack.undoPrimal(*mipsolver.options_mip_, solution);
-  calculateRowValuesQuad(*mipsolver.orig_model_, solution);
-  bool allow_try_again = true;
-try_again:
-
-  // compute the objective value in the original space
-  double bound_violation_ = 0;
-  double row_violation_ = 0;
-  double integrality_violation_ = 0;
+HighsCDouble HighsMipSolverData::evaluateOriginalSolution(
+    const HighsSolution& solution, double& bound_violation,
+    double& row_violation, double& integrality_violation) const {
+  bound_violation = 0;
+  row_violation = 0;
+  integrality_violation = 0;
 
   HighsCDouble obj = mipsolver.orig_model_->offset_;
   assert((HighsInt)solution.col_value.size() ==
@@ -673,8 +698,8 @@ try_again:
 
     if (mipsolver.orig_model_->integrality_[i] == HighsVarType::kInteger) {
       double intval = std::floor(value + 0.5);
-      integrality_violation_ =
-          std::max(std::fabs(intval - value), integrality_violation_);
+      integrality_violation =
+          std::max(std::fabs(intval - value), integrality_violation);
     }
 
     const double lower = mipsolver.orig_model_->col_lower_[i];
@@ -688,7 +713,7 @@ try_again:
     } else
       continue;
 
-    bound_violation_ = std::max(bound_violation_, primal_infeasibility);
+    bound_violation = std::max(bound_violation, primal_infeasibility);
   }
 
   for (HighsInt i = 0; i != mipsolver.orig_model_->num_row_; ++i) {
@@ -704,9 +729,59 @@ try_again:
     } else
       continue;
 
-    row_violation_ = std::max(row_violation_, primal_infeasibility);
+    row_violation = std::max(row_violation, primal_infeasibility);
   }
 
+  return obj;
+}
+
+void HighsMipSolverData::addPoolSolution(const std::vector<double>& sol,
+                                         double solobj) {
+  double rank = solobj + mipsolver.model_->offset_;
+  if (mipsolver.submip || !mipsolver.solutionPool.accepts(rank)) return;
+
+  HighsSolution solution;
+  solution.col_value = sol;
+  calculateRowValuesQuad(*mipsolver.orig_model_, solution);
+  solution.value_valid = true;
+
+  postSolveStack.undoPrimal(*mipsolver.options_mip_, solution);
+  calculateRowValuesQuad(*mipsolver.orig_model_, solution);
+
+  // unlike a new incumbent the solution is not repaired if it violates the
+  // original model
+  double bound_violation;
+  double row_violation;
+  double integrality_violation;
+  HighsCDouble obj = evaluateOriginalSolution(
+      solution, bound_violation, row_violation, integrality_violation);
+  if (std::max({bound_violation, row_violation, integrality_violation}) >
+      mipsolver.options_mip_->mip_feasibility_tolerance)
+    return;
+
+  mipsolver.solutionPool.addSolution(solution.col_value, double(obj), rank,
+                                     mipsolver.orig_model_->integrality_);
+}
+
+double HighsMipSolverData::transformNewIncumbent(
+    const std::vector<double>& sol) {
+  HighsSolution solution;
+  solution.col_value = sol;
+  calculateRowValuesQuad(*mipsolver.orig_model_, solution);
+  solution.value_valid = true;
+
+  postSolveStack.undoPrimal(*mipsolver.options_mip_, solution);
+  calculateRowValuesQuad(*mipsolver.orig_model_, solution);
+  bool allow_try_again = true;
+try_again:
+
+  // compute the objective value in the original space
+  double bound_violation_;
+  double row_violation_;
+  double integrality_violation_;
+  HighsCDouble obj = evaluateOriginalSolution(
+      solution, bound_violation_, row_violation_, integrality_violation_);
+
   bool feasible =
       bound_violation_ <= mipsolver.options_mip_->mip_feasibility_tolerance &&
       integrality_violation_ <=
@@ -742,11 +817,22 @@ try_again:
       goto try_again;
     }
   }
+  // objective value in the transformed space
+  double transformed_obj =
+      mipsolver.orig_model_->sense_ == ObjSense::kMaximize
+          ? -double(obj + mipsolver.model_->offset_)
+          : double(obj - mipsolver.model_->offset_);
+
   // store the solution as incumbent in the original space if there is no
   // solution or if it is feasible
   if (feasible) {
     // if (!allow_try_again)
     //   printf("repaired solution with value %g\n", double(obj));
+    if (!mipsolver.submip)
+      mipsolver.solutionPool.addSolution(
+          solution.col_value, double(obj),
+          double(obj) * int(mipsolver.orig_model_->sense_),
+          mipsolver.orig_model_->integrality_);
     // store
     mipsolver.row_violation_ = row_violation_;
     mipsolver.bound_violation_ = bound_violation_;
@@ -782,11 +868,7 @@ try_again:
     return kHighsInf;
   }
 
-  // return the objective value in the transformed space
-  if (mipsolver.orig_model_->sense_ == ObjSense::kMaximize)
-    return -double(obj + mipsolver.model_->offset_);
-
-  return double(obj - mipsolver.model_->offset_);
+  return transformed_obj;
 }
 
 double HighsMipSolverData::percentageInactiveIntegers() const {
@@ -796,6 +878,10 @@ double HighsMipSolverData::percentageInactiveIntegers() const {
 }
 
 void HighsMipSolverData::performRestart() {
+  // solutions of the background sub-MIP are in the space of the current
+  // presolved model
+  heuristics.collectBackgroundSubMip(true);
+
   HighsBasis root_basis;
   HighsPseudocostInitialization pscostinit(
       pseudocost, mipsolver.options_mip_->mip_pscost_minreliable,
@@ -810,6 +896,8 @@ void HighsMipSolverData::performRestart() {
   heuristic_lp_iterations_before_run = heuristic_lp_iterations;
   sepa_lp_iterations_before_run = sepa_lp_iterations;
   sb_lp_iterations_before_run = sb_lp_iterations;
+  saveRestartPools();
+
   HighsInt numLpRows = lp.getLp().num_row_;
   HighsInt numModelRows = mipsolver.numRow();
   HighsInt numCuts = numLpRows - numModelRows;
@@ -876,6 +964,7 @@ void HighsMipSolverData::performRestart() {
     return;
   }
   runSetup();
+  restoreRestartConflicts();
 
   postSolveStack.removeCutsFromModel(numCuts);
 
@@ -887,6 +976,430 @@ void HighsMipSolverData::performRestart() {
   mipsolver.pscostinit = nullptr;
 }
 
+void HighsMipSolverData::saveRestartPools() {
+  restartPools.clear();
+  restartPools.num_reductions = postSolveStack.numReductions();
+
+  // conflicts are stored without the bound changes that hold globally and are
+  // discarded if one of their bound changes can no longer hold
+  const std::vector<HighsDomainChange>& conflictEntries =
+      conflictPool.getConflictEntryVector();
+  restartPools.conflict_start.push_back(0);
+  for (const std::pair<HighsInt, HighsInt>& range :
+       conflictPool.getConflictRanges()) {
+    if (range.first == -1) continue;
+    size_t start = restartPools.conflict_entries.size();
+    bool redundant = false;
+    for (HighsInt i = range.first; i != range.second; ++i) {
+      HighsDomainChange domchg = conflictEntries[i];
+      if (domain.isActive(domchg)) continue;
+      if (domchg.boundtype == HighsBoundType::kLower
+              ? domain.col_upper_[domchg.column] < domchg.boundval - feastol
+              : domain.col_lower_[domchg.column] > domchg.boundval + feastol) {
+        redundant = true;
+        break;
+      }
+      domchg.column = postSolveStack.getOrigColIndex(domchg.column);
+      restartPools.conflict_entries.push_back(domchg);
+    }
+
+    if (redundant || restartPools.conflict_entries.size() == start)
+      restartPools.conflict_entries.resize(start);
+    else
+      restartPools.conflict_start.push_back(
+          restartPools.conflict_entries.size());
+  }
+
+  // the cuts of the LP are appended to the model and end up in the cut pool
+  // of the presolved model, so only the remaining cuts are stored with the
+  // globally fixed columns moved to the right hand side
+  const HighsDynamicRowMatrix& cutMatrix = cutpool.getMatrix();
+  const HighsInt* cutIndex = cutMatrix.getARindex();
+  const double* cutValue = cutMatrix.getARvalue();
+  restartPools.cut_start.push_back(0);
+  for (HighsInt i = 0; i != cutMatrix.getNumRows(); ++i) {
+    HighsInt start = cutMatrix.getRowStart(i);
+    if (start == -1 || cutpool.cutIsInLp(i)) continue;
+    HighsInt end = cutMatrix.getRowEnd(i);
+    HighsCDouble upper = cutpool.getRhs()[i];
+    size_t cutStart = restartPools.cut_index.size();
+    for (HighsInt j = start; j != end; ++j) {
+      HighsInt col = cutIndex[j];
+      if (domain.isFixed(col)) {
+        upper -= cutValue[j] * domain.col_lower_[col];
+        continue;
+      }
+      restartPools.cut_index.push_back(postSolveStack.getOrigColIndex(col));
+      restartPools.cut_value.push_back(cutValue[j]);
+    }
+
+    if (restartPools.cut_index.size() == cutStart) continue;
+    restartPools.cut_start.push_back(restartPools.cut_index.size());
+    restartPools.cut_upper.push_back(double(upper));
+    restartPools.cut_integral.push_back(cutpool.cutIsIntegral(i));
+  }
+}
+
+std::vector<HighsInt> HighsMipSolverData::getReducedColIndex() const {
+  std::vector<HighsInt> reducedColIndex(postSolveStack.getOrigNumCol(), -1);
+  for (HighsInt i = 0; i != mipsolver.numCol(); ++i)
+    reducedColIndex[postSolveStack.getOrigColIndex(i)] = i;
+
+  return reducedColIndex;
+}
+
+void HighsMipSolverData::restoreRestartConflicts() {
+  // the columns of the presolved model may have been shifted or scaled by
+  // presolve after the restart, which is undone for the stored conflicts and
+  // cuts, while columns that were removed or merged with a duplicate column
+  // can not be expressed in the presolved model
+  postSolveStack.getLinearTransforms(restartPools.num_reductions,
+                                     restartPools.col_scale,
+                                     restartPools.col_constant);
+
+  // conflicts on such columns are dropped
+  std::vector<HighsInt> reducedColIndex = getReducedColIndex();
+  std::vector<HighsDomainChange> conflict;
+  HighsInt numConflicts = (HighsInt)restartPools.conflict_start.size() - 1;
+  for (HighsInt i = 0; i < numConflicts; ++i) {
+    conflict.clear();
+    for (HighsInt k = restartPools.conflict_start[i];
+         k != restartPools.conflict_start[i + 1]; ++k) {
+      HighsDomainChange domchg = restartPools.conflict_entries[k];
+      HighsInt origCol = domchg.column;
+      domchg.column = reducedColIndex[origCol];
+      if (domchg.column == -1 ||
+          !postSolveStack.isColLinearlyTransformable(origCol))
+        break;
+      // x = scale * x' + constant, so a bound on x is a bound on x' that
+      // changes its type if the scale is negative
+      double scale = restartPools.col_scale[origCol];
+      domchg.boundval =
+          (domchg.boundval - restartPools.col_constant[origCol]) / scale;
+      if (scale < 0)
+        domchg.boundtype = domchg.boundtype == HighsBoundType::kLower
+                               ? HighsBoundType::kUpper
+                               : HighsBoundType::kLower;
+      if (mipsolver.variableType(domchg.column) != HighsVarType::kContinuous)
+        domchg.boundval = domchg.boundtype == HighsBoundType::kLower
+                              ? std::ceil(domchg.boundval - feastol)
+                              : std::floor(domchg.boundval + feastol);
+      conflict.push_back(domchg);
+    }
+
+    if ((HighsInt)conflict.size() ==
+        restartPools.conflict_start[i + 1] - restartPools.conflict_start[i])
+      conflictPool.addConflict(conflict.data(), conflict.size());
+  }
+
+  restartPools.conflict_entries.clear();
+  restartPools.conflict_start.clear();
+}
+
+void HighsMipSolverData::restoreRestartCuts() {
+  if (restartPools.cut_upper.empty()) return;
+
+  // cuts are transformed like the conflicts and dropped on the same columns
+  assert(!restartPools.col_scale.empty());
+  std::vector<HighsInt> reducedColIndex = getReducedColIndex();
+  std::vector<HighsInt> cutinds;
+  std::vector<double> cutvals;
+  HighsInt numCuts = restartPools.cut_upper.size();
+  for (HighsInt i = 0; i != numCuts; ++i) {
+    cutinds.clear();
+    cutvals.clear();
+    HighsCDouble upper = restartPools.cut_upper[i];
+    // the activity of an integral cut stays integral for integral shifts
+    // and flips of its columns
+    bool integral = restartPools.cut_integral[i];
+    for (HighsInt k = restartPools.cut_start[i];
+         k != restartPools.cut_start[i + 1]; ++k) {
+      HighsInt origCol = restartPools.cut_index[k];
+      HighsInt col = reducedColIndex[origCol];
+      if (col == -1 || !postSolveStack.isColLinearlyTransformable(origCol))
+        break;
+      double scale = restartPools.col_scale[origCol];
+      double constant = restartPools.col_constant[origCol];
+      upper -= restartPools.cut_value[k] * constant;
+      if (std::abs(scale) != 1.0 || constant != std::round(constant))
+        integral = false;
+      cutinds.push_back(col);
+      cutvals.push_back(restartPools.cut_value[k] * scale);
+    }
+
+    if ((HighsInt)cutinds.size() ==
+        restartPools.cut_start[i + 1] - restartPools.cut_start[i])
+      cutpool.addCut(mipsolver, cutinds.data(), cutvals.data(), cutinds.size(),
+                     double(upper), integral, true, false, false);
+  }
+
+  restartPools.clear();
+}
+
+void HighsMipSolverData::restoreCheckpoint(
+    const HighsMipCheckpoint& checkpoint) {
+  // the checkpoint takes the place of presolve: it provides the presolved
+  // model with the global domain of the interrupted search together with the
+  // information on the model that was collected during that search
+  presolvedModel = checkpoint.model;
+  mipsolver.model_ = &presolvedModel;
+  postSolveStack = checkpoint.postsolve_stack;
+
+  const double sense = (int)mipsolver.orig_model_->sense_;
+  if (checkpoint.solution_objective != kHighsInf &&
+      (mipsolver.solution_objective_ == kHighsInf ||
+       checkpoint.solution_objective * sense <
+           mipsolver.solution_objective_ * sense)) {
+    mipsolver.solution_ = checkpoint.solution;
+    mipsolver.solution_objective_ = checkpoint.solution_objective;
+    mipsolver.bound_violation_ = checkpoint.bound_violation;
+    mipsolver.integrality_violation_ = checkpoint.integrality_violation;
+    mipsolver.row_violation_ = checkpoint.row_violation;
+  }
+
+  const HighsInt numCol = presolvedModel.num_col_;
+  rowMatrixSet = false;
+  objectiveFunction = HighsObjectiveFunction(mipsolver);
+  domain = HighsDomain(mipsolver);
+
+  // drop the data for the original model and add the stored cliques and
+  // variable bounds, whereas implications are computed again when needed
+  std::vector<HighsInt> origColsDeleted(mipsolver.orig_model_->num_col_, -1);
+  cliquetable.rebuild(numCol, postSolveStack, domain, origColsDeleted,
+                      std::vector<HighsInt>());
+  std::vector<HighsCliqueTable::CliqueVar> clique;
+  HighsInt start = 0;
+  for (size_t i = 0; i != checkpoint.clique_end.size(); ++i) {
+    clique.clear();
+    for (HighsInt k = start; k != checkpoint.clique_end[i]; ++k)
+      clique.emplace_back(checkpoint.clique_vars[k] >> 1,
+                          checkpoint.clique_vars[k] & 1);
+    cliquetable.doAddClique(clique.data(), clique.size(),
+                            checkpoint.clique_equality[i]);
+    start = checkpoint.clique_end[i];
+  }
+  cliquetable.setMaxEntries(mipsolver.numNonzero());
+
+  implications.rebuild(numCol, origColsDeleted, std::vector<HighsInt>());
+  for (const HighsMipCheckpoint::VarBound& vb : checkpoint.varbounds) {
+    if (vb.upper)
+      implications.addVUB(vb.col, vb.vbcol, vb.coef, vb.constant);
+    else
+      implications.addVLB(vb.col, vb.vbcol, vb.coef, vb.constant);
+  }
+
+  cutpool = HighsCutPool(numCol, mipsolver.options_mip_->mip_pool_age_limit,
+                         mipsolver.options_mip_->mip_pool_soft_limit);
+  conflictPool =
+      HighsConflictPool(5 * mipsolver.options_mip_->mip_pool_age_limit,
+                        mipsolver.options_mip_->mip_pool_soft_limit);
+  domain.addCutpool(cutpool);
+  domain.addConflictPool(conflictPool);
+
+  std::vector<HighsInt> cutinds;
+  std::vector<double> cutvals;
+  HighsInt numCuts = checkpoint.cut_upper.size();
+  for (HighsInt i = 0; i != numCuts; ++i) {
+    HighsInt cutstart = checkpoint.cut_start[i];
+    HighsInt cutend = checkpoint.cut_start[i + 1];
+    cutinds.assign(checkpoint.cut_index.begin() + cutstart,
+                   checkpoint.cut_index.begin() + cutend);
+    cutvals.assign(checkpoint.cut_value.begin() + cutstart,
+                   checkpoint.cut_value.begin() + cutend);
+    cutpool.addCut(mipsolver, cutinds.data(), cutvals.data(), cutinds.size(),
+                   checkpoint.cut_upper[i], checkpoint.cut_integral[i], true,
+                   false, false);
+  }
+
+  HighsInt numConflicts = (HighsInt)checkpoint.conflict_start.size() - 1;
+  for (HighsInt i = 0; i < numConflicts; ++i)
+    conflictPool.addConflict(
+        checkpoint.conflict_entries.data() + checkpoint.conflict_start[i],
+        checkpoint.conflict_start[i + 1] - checkpoint.conflict_start[i]);
+
+  // the pseudocosts are given for the original model and are transformed
+  // when they are set up for the presolved model
+  mipsolver.pscostinit = &checkpoint.pscost;
+
+  pruned_treeweight = checkpoint.pruned_treeweight;
+  num_nodes = checkpoint.num_nodes;
+  num_leaves = checkpoint.num_leaves;
+  total_lp_iterations = checkpoint.total_lp_iterations;
+  heuristic_lp_iterations = checkpoint.heuristic_lp_iterations;
+  sepa_lp_iterations = checkpoint.sepa_lp_iterations;
+  sb_lp_iterations = checkpoint.sb_lp_iterations;
+  propagation_steps = checkpoint.propagation_steps;
+  separation_steps = checkpoint.separation_steps;
+  num_nodes_before_run = num_nodes;
+  num_leaves_before_run = num_leaves;
+  total_lp_iterations_before_run = total_lp_iterations;
+  heuristic_lp_iterations_before_run = heuristic_lp_iterations;
+  sepa_lp_iterations_before_run = sepa_lp_iterations;
+  sb_lp_iterations_before_run = sb_lp_iterations;
+  firstrootlpiters = checkpoint.firstrootlpiters;
+  avgrootlpiters = checkpoint.avgrootlpiters;
+}
+
+void HighsMipSolverData::resumeSearch(const HighsMipCheckpoint& checkpoint) {
+  numRestarts = checkpoint.num_restarts;
+  highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+               "\nResuming the search from a checkpoint with %" HIGHSINT_FORMAT
+               " open nodes\n",
+               (HighsInt)checkpoint.nodes.size());
+
+  // the root node was processed before the checkpoint was taken, so only
+  // the root LP is solved with the cuts of the pool, as after a restart
+  lp.setIterationLimit();
+  lp.loadModel();
+  domain.clearChangedCols();
+  lp.setObjectiveLimit(upper_limit);
+  lower_bound = std::max(lower_bound, domain.getObjectiveLowerBound());
+  printDisplayLine();
+
+  lp.getLpSolver().setOptionValue("presolve", "on");
+  HighsLpRelaxation::Status status = evaluateRootLp();
+  lp.getLpSolver().setOptionValue("presolve", "off");
+  if (status == HighsLpRelaxation::Status::kInfeasible ||
+      status == HighsLpRelaxation::Status::kUnbounded)
+    return;
+
+  firstlpsol = lp.getSolution().col_value;
+  firstlpsolobj = lp.getObjective();
+  rootlpsol = firstlpsol;
+  rootlpsolobj = firstlpsolobj;
+
+  if (lp.getLpSolver().getBasis().valid)
+    firstrootbasis = lp.getLpSolver().getBasis();
+  else {
+    firstrootbasis.col_status.assign(mipsolver.numCol(),
+                                     HighsBasisStatus::kNonbasic);
+    firstrootbasis.row_status.assign(mipsolver.numRow(),
+                                     HighsBasisStatus::kBasic);
+    firstrootbasis.valid = true;
+  }
+
+  if (cutpool.getNumCuts() != 0) {
+    HighsCutSet cutset;
+    cutpool.separateLpCutsAfterRestart(cutset);
+    lp.addCuts(cutset);
+    status = evaluateRootLp();
+    lp.removeObsoleteRows();
+    if (status == HighsLpRelaxation::Status::kInfeasible) return;
+  }
+
+  lp.setIterationLimit(std::max(10000, int(10 * avgrootlpiters)));
+  last_disptime = -kHighsInf;
+
+  for (const HighsMipCheckpoint::Node& node : checkpoint.nodes) {
+    std::vector<HighsDomainChange> domchgstack = node.domchgstack;
+    std::vector<HighsInt> branchings = node.branchings;
+    pruned_treeweight += nodequeue.emplaceNode(
+        std::move(domchgstack), std::move(branchings), node.lower_bound,
+        node.estimate, node.depth);
+  }
+}
+
+void HighsMipSolverData::saveCheckpoint(HighsMipCheckpoint& checkpoint) const {
+  checkpoint.clear();
+  if (nodequeue.empty()) return;
+
+  const HighsLp& origModel = *mipsolver.orig_model_;
+  checkpoint.orig_num_col = origModel.num_col_;
+  checkpoint.orig_num_row = origModel.num_row_;
+  checkpoint.orig_model_hash = mipCheckpointModelHash(origModel);
+
+  checkpoint.model = presolvedModel;
+  checkpoint.model.col_lower_ = domain.col_lower_;
+  checkpoint.model.col_upper_ = domain.col_upper_;
+  checkpoint.postsolve_stack = postSolveStack;
+
+  checkpoint.solution = mipsolver.solution_;
+  checkpoint.solution_objective = mipsolver.solution_objective_;
+  checkpoint.bound_violation = mipsolver.bound_violation_;
+  checkpoint.integrality_violation = mipsolver.integrality_violation_;
+  checkpoint.row_violation = mipsolver.row_violation_;
+
+  checkpoint.num_restarts = numRestarts;
+  checkpoint.pruned_treeweight = double(pruned_treeweight);
+  checkpoint.num_nodes = num_nodes;
+  checkpoint.num_leaves = num_leaves;
+  checkpoint.total_lp_iterations = total_lp_iterations;
+  checkpoint.heuristic_lp_iterations = heuristic_lp_iterations;
+  checkpoint.sepa_lp_iterations = sepa_lp_iterations;
+  checkpoint.sb_lp_iterations = sb_lp_iterations;
+  checkpoint.propagation_steps = propagation_steps;
+  checkpoint.separation_steps = separation_steps;
+  checkpoint.firstrootlpiters = firstrootlpiters;
+  checkpoint.avgrootlpiters = avgrootlpiters;
+
+  for (HighsNodeQueue::OpenNode& node : nodequeue.getOpenNodes())
+    checkpoint.nodes.push_back(HighsMipCheckpoint::Node{
+        std::move(node.domchgstack), std::move(node.branchings),
+        node.lower_bound, node.estimate, node.depth});
+
+  checkpoint.pscost =
+      HighsPseudocostInitialization(pseudocost, kHighsIInf, postSolveStack);
+
+  const HighsDynamicRowMatrix& cutMatrix = cutpool.getMatrix();
+  checkpoint.cut_start.push_back(0);
+  for (HighsInt i = 0; i != cutMatrix.getNumRows(); ++i) {
+    HighsInt start = cutMatrix.getRowStart(i);
+    if (start == -1) continue;
+    HighsInt end = cutMatrix.getRowEnd(i);
+    checkpoint.cut_index.insert(checkpoint.cut_index.end(),
+                                cutMatrix.getARindex() + start,
+                                cutMatrix.getARindex() + end);
+    checkpoint.cut_value.insert(checkpoint.cut_value.end(),
+                                cutMatrix.getARvalue() + start,
+                                cutMatrix.getARvalue() + end);
+    checkpoint.cut_start.push_back(checkpoint.cut_index.size());
+    checkpoint.cut_upper.push_back(cutpool.getRhs()[i]);
+    checkpoint.cut_integral.push_back(cutpool.cutIsIntegral(i));
+  }
+
+  const std::vector<HighsDomainChange>& conflictEntries =
+      conflictPool.getConflictEntryVector();
+  checkpoint.conflict_start.push_back(0);
+  for (const std::pair<HighsInt, HighsInt>& range :
+       conflictPool.getConflictRanges()) {
+    if (range.first == -1) continue;
+    checkpoint.conflict_entries.insert(checkpoint.conflict_entries.end(),
+                                       conflictEntries.begin() + range.first,
+                                       conflictEntries.begin() + range.second);
+    checkpoint.conflict_start.push_back(checkpoint.conflict_entries.size());
+  }
+
+  std::vector<HighsCliqueTable::CliqueVar> cliqueVars;
+  cliquetable.getCliques(cliqueVars, checkpoint.clique_end,
+                         checkpoint.clique_equality);
+  checkpoint.clique_vars.reserve(cliqueVars.size());
+  for (HighsCliqueTable::CliqueVar v : cliqueVars)
+    checkpoint.clique_vars.push_back(v.index());
+
+  for (HighsInt col = 0; col != mipsolver.numCol(); ++col) {
+    for (const auto& vub : implications.getVUBs(col)) {
+      HighsMipCheckpoint::VarBound vb{};
+      vb.col = col;
+      vb.vbcol = vub.first;
+      vb.coef = vub.second.coef;
+      vb.constant = vub.second.constant;
+      vb.upper = true;
+      checkpoint.varbounds.push_back(vb);
+    }
+    for (const auto& vlb : implications.getVLBs(col)) {
+      HighsMipCheckpoint::VarBound vb{};
+      vb.col = col;
+      vb.vbcol = vlb.first;
+      vb.coef = vlb.second.coef;
+      vb.constant = vlb.second.constant;
+      vb.upper = false;
+      checkpoint.varbounds.push_back(vb);
+    }
+  }
+
+  checkpoint.valid = true;
+}
+
 void HighsMipSolverData::basisTransfer() {
   // if a root basis is given, construct a basis for the root LP from
   // in the reduced problem space after presolving
@@ -918,40 +1431,38 @@ const std::vector<double>& HighsMipSolverData::getSolution() const {
 
 bool HighsMipSolverData::addIncumbent(const std::vector<double>& sol,
                                       double solobj, char source) {
-  if (solobj < upper_bound) {
+  const bool improving = solobj < upper_bound;
+  if (improving) {
     solobj = transformNewIncumbent(sol);
     if (solobj >= upper_bound) return false;
     upper_bound = solobj;
     incumbent = sol;
-    double new_upper_limit = computeNewUpperLimit(solobj, 0.0, 0.0);
-
-    if (new_upper_limit < upper_limit) {
-      ++numImprovingSols;
-      upper_limit = new_upper_limit;
-      optimality_limit =
-          computeNewUpperLimit(solobj, mipsolver.options_mip_->mip_abs_gap,
-                               mipsolver.options_mip_->mip_rel_gap);
-      nodequeue.setOptimalityLimit(optimality_limit);
-      debugSolution.newIncumbentFound();
-      domain.propagate();
-      if (!domain.infeasible()) redcostfixing.propagateRootRedcost(mipsolver);
-
-      if (domain.infeasible()) {
-        pruned_treeweight = 1.0;
-        nodequeue.clear();
-        return true;
-      }
-      cliquetable.extractObjCliques(mipsolver);
-      if (domain.infeasible()) {
-        pruned_treeweight = 1.0;
-        nodequeue.clear();
-        return true;
-      }
-      pruned_treeweight += nodequeue.performBounding(upper_limit);
-      printDisplayLine(source);
+    ++numImprovingSols;
+  } else {
+    if (incumbent.empty()) incumbent = sol;
+    addPoolSolution(sol, solobj);
+  }
+
+  if (updateUpperLimit()) {
+    debugSolution.newIncumbentFound();
+    domain.propagate();
+    if (!domain.infeasible()) redcostfixing.propagateRootRedcost(mipsolver);
+
+    if (domain.infeasible()) {
+      pruned_treeweight = 1.0;
+      nodequeue.clear();
+      return true;
     }
-  } else if (incumbent.empty())
-    incumbent = sol;
+    cliquetable.extractObjCliques(mipsolver);
+    if (domain.infeasible()) {
+      pruned_treeweight = 1.0;
+      nodequeue.clear();
+      return true;
+    }
+    pruned_treeweight += nodequeue.performBounding(upper_limit);
+  }
+
+  if (improving) printDisplayLine(source);
 
   return true;
 }
@@ -1181,10 +1692,13 @@ HighsLpRelaxation::Status HighsMipSolverData::evaluateRootLp() {
         return status;
       }
 
+      // with a solution pool the search continues to find the other
+      // solutions that enter the pool
       if (status == HighsLpRelaxation::Status::kOptimal &&
           lp.getFractionalIntegers().empty() &&
           addIncumbent(lp.getLpSolver().getSolution().col_value,
-                       lp.getObjective(), 'T')) {
+                       lp.getObjective(), 'T') &&
+          !mipsolver.solutionPool.enabled()) {
         mipsolver.modelstatus_ = HighsModelStatus::kOptimal;
         lower_bound = upper_bound;
         pruned_treeweight = 1.0;
@@ -1303,6 +1817,10 @@ restart:
     if (status == HighsLpRelaxation::Status::kInfeasible) return;
   }
 
+  // the cuts that were only in the cut pool before a restart are added after
+  // the cuts of the LP, so that they are only separated when violated
+  restoreRestartCuts();
+
   lp.setIterationLimit(std::max(10000, int(10 * avgrootlpiters)));
 
   // make sure first line after solving root LP is printed
@@ -1573,6 +2091,149 @@ restart:
   }
 }
 
+void HighsMipSolverData::raceRootNode() {
+  // Evaluate the root node while racers solve the root node of the same
+  // model with different random seeds. Their incumbents and cuts are then
+  // passed to this solver, which continues the search from its own root
+  // with the best dual bound that any of the racers proved
+  const HighsInt numRacers = mipsolver.options_mip_->mip_root_racers - 1;
+  const HighsInt numRestartsBefore = numRestarts;
+  // the model and postsolve stack are copied, since a restart of this
+  // solver overwrites them while the racers are running
+  HighsLp racerModel = *mipsolver.model_;
+  racerModel.offset_ = 0;
+  presolve::HighsPostsolveStack racerPostSolveStack = postSolveStack;
+
+  std::vector<HighsOptions> racerOptions(numRacers, *mipsolver.options_mip_);
+  for (HighsInt i = 0; i < numRacers; ++i) {
+    HighsOptions& options = racerOptions[i];
+    options.output_flag = false;
+    // the racers are not sub-MIPs, so that they separate as many rounds
+    // as this solver does, but must not write the files or run the
+    // heuristics of the top-level solve
+    options.mip_trace_file = "";
+    options.presolve_profile_file = "";
+    options.mip_solution_pool_size = 0;
+    options.mip_background_heuristics = false;
+    options.mip_improvement_heuristics = false;
+    options.presolve = kHighsOffString;
+    options.mip_root_racers = 1;
+    options.mip_max_nodes = 1;
+    options.mip_detect_symmetry = false;
+    options.random_seed = mipsolver.options_mip_->random_seed + i + 1;
+    if (i % 2 == 0)
+      options.mip_heuristic_effort =
+          std::min(1.0, 2.0 * options.mip_heuristic_effort);
+    options.time_limit -= mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+    options.objective_bound = upper_limit;
+  }
+
+  HighsSolution solution;
+  solution.value_valid = false;
+  solution.dual_valid = false;
+  std::vector<std::unique_ptr<HighsMipSolver>> racers(numRacers);
+  highs::parallel::TaskGroup tg;
+  for (HighsInt i = 0; i < numRacers; ++i)
+    tg.spawn([&, i]() {
+      racers[i] = std::unique_ptr<HighsMipSolver>(
+          new HighsMipSolver(racerOptions[i], racerModel, solution, false));
+      racers[i]->run();
+    });
+
+  evaluateRootNode();
+  tg.taskWait();
+
+  // merge the results in the order of the racers, so that the search is
+  // deterministic regardless of which racer finished first
+  const bool sameModel = numRestarts == numRestartsBefore;
+  double racerLowerBound = -kHighsInf;
+  for (HighsInt i = 0; i < numRacers; ++i) {
+    HighsMipSolver& racer = *racers[i];
+    if (!racer.mipdata_) continue;
+    total_lp_iterations += racer.mipdata_->total_lp_iterations;
+    propagation_steps += racer.mipdata_->propagation_steps;
+    separation_steps += racer.mipdata_->separation_steps;
+    // the racers prune with the incumbent of this solver, so their dual
+    // bound is valid for any solution that improves on it
+    if (sameModel)
+      racerLowerBound = std::max(racerLowerBound, racer.mipdata_->lower_bound);
+
+    if (racer.solution_objective_ != kHighsInf) {
+      const double upperBoundBefore = upper_bound;
+      if (sameModel)
+        trySolution(racer.solution_, 'C');
+      else {
+        // transform the solution into the original space, and from there
+        // into the space of the model after the restart
+        HighsSolution racerSolution;
+        racerSolution.col_value = std::move(racer.solution_);
+        calculateRowValuesQuad(*mipsolver.orig_model_, racerSolution);
+        racerSolution.value_valid = true;
+        racerPostSolveStack.undoPrimal(*mipsolver.options_mip_,
+                                       racerSolution);
+        trySolution(
+            postSolveStack.getReducedPrimalSolution(racerSolution.col_value),
+            'C');
+      }
+      if (upper_bound < upperBoundBefore) ++num_racer_solutions;
+    }
+  }
+
+  // cuts are only valid in the space of the model that was raced. The cut
+  // pools of the racers are read concurrently, and their cuts are added to
+  // the cut pool in a concurrent epoch
+  HighsInt numCuts = 0;
+  if (sameModel && mipsolver.modelstatus_ == HighsModelStatus::kNotset &&
+      !domain.infeasible()) {
+    cutpool.beginConcurrentEpoch();
+    highs::parallel::for_each(
+        0, numRacers,
+        [&](HighsInt start, HighsInt end) {
+          std::vector<HighsInt> cutinds;
+          std::vector<double> cutvals;
+          for (HighsInt i = start; i < end; ++i) {
+            if (!racers[i]->mipdata_) continue;
+            const HighsCutPool& racerCutpool = racers[i]->mipdata_->cutpool;
+            const HighsInt numPoolRows = racerCutpool.getRhs().size();
+            for (HighsInt cut = 0; cut < numPoolRows; ++cut) {
+              if (racerCutpool.getRhs()[cut] == kHighsInf) continue;
+              HighsInt cutlen;
+              const HighsInt* inds;
+              const double* vals;
+              racerCutpool.getCut(cut, cutlen, inds, vals);
+              cutinds.assign(inds, inds + cutlen);
+              cutvals.assign(vals, vals + cutlen);
+              cutpool.addCut(mipsolver, cutinds.data(), cutvals.data(),
+                             cutlen, racerCutpool.getRhs()[cut],
+                             racerCutpool.cutIsIntegral(cut));
+            }
+          }
+        },
+        1);
+    numCuts = cutpool.commitPendingCuts(mipsolver);
+    num_racer_cuts += numCuts;
+  }
+
+  // replace the root node by one with the dual bound of the best racer
+  if (racerLowerBound > lower_bound && nodequeue.numNodes() == 1 &&
+      mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+    nodequeue.clear();
+    lower_bound = racerLowerBound;
+    if (lower_bound <= upper_limit)
+      nodequeue.emplaceNode(std::vector<HighsDomainChange>(),
+                            std::vector<HighsInt>(), lower_bound,
+                            lp.computeBestEstimate(pseudocost), 1);
+    else
+      pruned_treeweight = 1.0;
+    ++num_racer_root_bounds;
+  }
+
+  highsLogDev(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+              "Root node racing: %" HIGHSINT_FORMAT
+              " racers passed %" HIGHSINT_FORMAT " cuts\n",
+              numRacers, numCuts);
+}
+
 bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
   const HighsOptions& options = *mipsolver.options_mip_;
 
@@ -1605,6 +2266,16 @@ bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
     return true;
   }
 
+  if (options.mip_work_limit != kHighsInf &&
+      workUnits() >= options.mip_work_limit) {
+    if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+      highsLogDev(options.log_options, HighsLogType::kInfo,
+                  "reached work limit\n");
+      mipsolver.modelstatus_ = HighsModelStatus::kIterationLimit;
+    }
+    return true;
+  }
+
   if (mipsolver.timer_.read(mipsolver.timer_.solve_clock) >=
       options.time_limit) {
     if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
@@ -23,6 +23,7 @@
 #include "mip/HighsDomain.h"
 #include "mip/HighsImplications.h"
 #include "mip/HighsLpRelaxation.h"
+#include "mip/HighsMipCheckpoint.h"
 #include "mip/HighsNodeQueue.h"
 #include "mip/HighsObjectiveFunction.h"
 #include "mip/HighsPrimalHeuristics.h"
@@ -103,6 +104,18 @@ struct HighsMipSolverData {
   int64_t heuristic_lp_iterations_before_run;
   int64_t sepa_lp_iterations_before_run;
   int64_t sb_lp_iterations_before_run;
+  int64_t propagation_steps;
+  int64_t separation_steps;
+  int64_t num_conflict_propagations;
+  int64_t num_conflict_cutoffs;
+  int64_t num_symmetry_nodes;
+  int64_t num_racer_cuts;
+  int64_t num_racer_solutions;
+  int64_t num_racer_root_bounds;
+  int64_t num_parallel_separation_cuts;
+  int64_t num_background_sub_mips;
+  int64_t num_improvement_sub_mips;
+  int64_t num_improvement_heuristic_sols;
   int64_t num_disp_lines;
 
   HighsInt numImprovingSols;
@@ -114,6 +127,36 @@ struct HighsMipSolverData {
 
   HighsNodeQueue nodequeue;
 
+  // conflicts and cuts that are not part of the LP are carried over a restart
+  // indexed by the columns of the original model, and are transformed by the
+  // column transformations of the presolve after the restart
+  struct RestartPools {
+    size_t num_reductions = 0;
+    std::vector<double> col_scale;
+    std::vector<double> col_constant;
+    std::vector<HighsDomainChange> conflict_entries;
+    std::vector<HighsInt> conflict_start;
+    std::vector<HighsInt> cut_index;
+    std::vector<double> cut_value;
+    std::vector<HighsInt> cut_start;
+    std::vector<double> cut_upper;
+    std::vector<uint8_t> cut_integral;
+
+    void clear() {
+      num_reductions = 0;
+      col_scale.clear();
+      col_constant.clear();
+      conflict_entries.clear();
+      conflict_start.clear();
+      cut_index.clear();
+      cut_value.clear();
+      cut_start.clear();
+      cut_upper.clear();
+      cut_integral.clear();
+    }
+  };
+  RestartPools restartPools;
+
   HighsDebugSol debugSolution;
 
   HighsMipSolverData(HighsMipSolver& mipsolver)
@@ -152,6 +195,7 @@ struct HighsMipSolverData {
 
   double computeNewUpperLimit(double upper_bound, double mip_abs_gap,
                               double mip_rel_gap) const;
+  bool updateUpperLimit();
   bool moreHeuristicsAllowed();
   void removeFixedIndices();
   void init();
@@ -160,15 +204,28 @@ struct HighsMipSolverData {
   void runPresolve();
   void setupDomainPropagation();
   void runSetup();
+  void restoreCheckpoint(const HighsMipCheckpoint& checkpoint);
+  void resumeSearch(const HighsMipCheckpoint& checkpoint);
+  void saveCheckpoint(HighsMipCheckpoint& checkpoint) const;
   double transformNewIncumbent(const std::vector<double>& sol);
+  HighsCDouble evaluateOriginalSolution(const HighsSolution& solution,
+                                        double& bound_violation,
+                                        double& row_violation,
+                                        double& integrality_violation) const;
+  void addPoolSolution(const std::vector<double>& sol, double solobj);
   double percentageInactiveIntegers() const;
   void performRestart();
+  void saveRestartPools();
+  std::vector<HighsInt> getReducedColIndex() const;
+  void restoreRestartConflicts();
+  void restoreRestartCuts();
   bool checkSolution(const std::vector<double>& solution);
   bool trySolution(const std::vector<double>& solution, char source = ' ');
   bool rootSeparationRound(HighsSeparation& sepa, HighsInt& ncuts,
                            HighsLpRelaxation::Status& status);
   HighsLpRelaxation::Status evaluateRootLp();
   void evaluateRootNode();
+  void raceRootNode();
   bool addIncumbent(const std::vector<double>& sol, double solobj, char source);
 
   const std::vector<double>& getSolution() const;
@@ -184,6 +241,15 @@ struct HighsMipSolverData {
   }
 
   bool checkLimits(int64_t nodeOffset = 0) const;
+
+  // deterministic measure of the work done by the solver: a work unit
+  // corresponds to one simplex iteration, and a row, cut or conflict that is
+  // propagated, or a row that is scanned by a separator, counts as a
+  // hundredth of a work unit
+  double workUnits() const {
+    return double(total_lp_iterations) +
+           1e-2 * double(propagation_steps + separation_steps);
+  }
 };
 
 #endif
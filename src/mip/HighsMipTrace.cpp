@@ -0,0 +1,73 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "mip/HighsMipTrace.h"
+
+#include <cstdio>
+
+std::unique_ptr<HighsMipTrace> HighsMipTrace::open(
+    const std::string& filename) {
+  std::unique_ptr<HighsMipTrace> trace(new HighsMipTrace());
+  trace->out.open(filename, std::ios::out);
+  if (!trace->out.is_open()) return nullptr;
+
+  trace->out << "node,depth,selection,branching_col,lower_bound,estimate,"
+                "lp_iterations,propagation_time,cuts_in_lp,result\n";
+  return trace;
+}
+
+void HighsMipTrace::addNode(const Node& node) {
+  char line[512];
+  std::snprintf(line, sizeof(line),
+                "%lld,%d,%s,%d,%.17g,%.17g,%lld,%.6f,%d,%s\n",
+                (long long)numNodes++, int(node.depth),
+                selectionName(node.selection), int(node.branching_col),
+                node.lower_bound, node.estimate, (long long)node.lp_iterations,
+                node.propagation_time, int(node.num_cuts_in_lp),
+                resultName(node.result));
+  out << line;
+}
+
+const char* HighsMipTrace::selectionName(NodeSelection selection) {
+  switch (selection) {
+    case NodeSelection::kBestBound:
+      return "bestbound";
+    case NodeSelection::kBestEstimate:
+      return "bestestimate";
+    case NodeSelection::kChild:
+      return "child";
+    case NodeSelection::kBacktrack:
+      return "backtrack";
+    case NodeSelection::kPlunge:
+      return "plunge";
+  }
+
+  return "";
+}
+
+const char* HighsMipTrace::resultName(NodeResult result) {
+  switch (result) {
+    case NodeResult::kBoundExceeding:
+      return "boundexceeding";
+    case NodeResult::kDomainInfeasible:
+      return "domaininfeasible";
+    case NodeResult::kLpInfeasible:
+      return "lpinfeasible";
+    case NodeResult::kSuboptimal:
+      return "suboptimal";
+    case NodeResult::kOpen:
+      return "open";
+  }
+
+  return "";
+}
@@ -0,0 +1,77 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMipTrace.h
+ * @brief CSV trace with one record for each node that is processed by the
+ * branch-and-bound search, written when the option mip_trace_file is set
+ */
+#ifndef MIP_HIGHS_MIP_TRACE_H_
+#define MIP_HIGHS_MIP_TRACE_H_
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "util/HighsInt.h"
+
+class HighsMipTrace {
+ public:
+  // how the search arrived at a node
+  enum class NodeSelection {
+    kBestBound,
+    kBestEstimate,
+    kChild,
+    kBacktrack,
+    kPlunge,
+  };
+
+  // result of the evaluation of a node
+  enum class NodeResult {
+    kBoundExceeding,
+    kDomainInfeasible,
+    kLpInfeasible,
+    kSuboptimal,
+    kOpen,
+  };
+
+  struct Node {
+    HighsInt depth;
+    double lower_bound;
+    double estimate;
+    int64_t lp_iterations;
+    double propagation_time;
+    // cut rows in the LP relaxation after the node is evaluated, not only
+    // those that were separated at the node
+    HighsInt num_cuts_in_lp;
+    HighsInt branching_col;
+    NodeSelection selection;
+    NodeResult result;
+  };
+
+  // opens the trace and writes the header, returns nullptr if the file cannot
+  // be opened
+  static std::unique_ptr<HighsMipTrace> open(const std::string& filename);
+
+  // appends a record for the node that is numbered in the order of the calls
+  void addNode(const Node& node);
+
+  static const char* selectionName(NodeSelection selection);
+
+  static const char* resultName(NodeResult result);
+
+ private:
+  std::ofstream out;
+  int64_t numNodes = 0;
+};
+
+#endif
@@ -13,6 +13,7 @@
 #include "mip/HighsNodeQueue.h"
 
 #include <algorithm>
+#include <cmath>
 #include <tuple>
 
 #include "lp_data/HConst.h"
@@ -63,7 +64,7 @@ class HighsNodeQueue::NodeLowerRbTree : public CacheMinRbTree<NodeLowerRbTree> {
   }
   std::tuple<double, HighsInt, double, int64_t> getKey(HighsInt node) const {
     return std::make_tuple(nodeQueue->nodes[node].lower_bound,
-                           HighsInt(nodeQueue->nodes[node].domchgstack.size()),
+                           nodeQueue->nodes[node].domchgstacksize,
                            nodeQueue->nodes[node].estimate, node);
   }
 };
@@ -89,7 +90,7 @@ class HighsNodeQueue::NodeHybridEstimRbTree
     constexpr double kEstimWeight = 0.5;
     return std::make_tuple(kLbWeight * nodeQueue->nodes[node].lower_bound +
                                kEstimWeight * nodeQueue->nodes[node].estimate,
-                           -HighsInt(nodeQueue->nodes[node].domchgstack.size()),
+                           -nodeQueue->nodes[node].domchgstacksize,
                            node);
   }
 };
@@ -154,15 +155,32 @@ void HighsNodeQueue::unlink_suboptimal(int64_t node) {
   --numSuboptimal;
 }
 
-void HighsNodeQueue::link_domchgs(int64_t node) {
+std::vector<HighsDomainChange> HighsNodeQueue::decodeDomchgStack(
+    int64_t node) const {
+  std::vector<HighsDomainChange> domchgstack(nodes[node].domchgstacksize);
+  HighsInt end = nodes[node].domchgstacksize;
+  for (const DomchgSegment* segment = nodes[node].domchgsegment.get();
+       end > 0; segment = segment->parent.get()) {
+    if (end <= segment->parentSize) continue;
+    std::copy(segment->domchgs.begin(),
+              segment->domchgs.begin() + (end - segment->parentSize),
+              domchgstack.begin() + segment->parentSize);
+    end = segment->parentSize;
+  }
+
+  return domchgstack;
+}
+
+void HighsNodeQueue::link_domchgs(
+    int64_t node, const std::vector<HighsDomainChange>& domchgstack) {
   assert(node != -1);
-  HighsInt numchgs = nodes[node].domchgstack.size();
+  HighsInt numchgs = domchgstack.size();
   nodes[node].domchglinks.resize(numchgs);
 
   for (HighsInt i = 0; i != numchgs; ++i) {
-    double val = nodes[node].domchgstack[i].boundval;
-    HighsInt col = nodes[node].domchgstack[i].column;
-    switch (nodes[node].domchgstack[i].boundtype) {
+    double val = domchgstack[i].boundval;
+    HighsInt col = domchgstack[i].column;
+    switch (domchgstack[i].boundtype) {
       case HighsBoundType::kLower:
         nodes[node].domchglinks[i] =
             colLowerNodesPtr.get()[col].emplace(val, node).first;
@@ -176,11 +194,17 @@ void HighsNodeQueue::link_domchgs(int64_t node) {
 
 void HighsNodeQueue::unlink_domchgs(int64_t node) {
   assert(node != -1);
-  HighsInt numchgs = nodes[node].domchgstack.size();
+  // popped nodes have their domain change stack filled already
+  std::vector<HighsDomainChange> decodedstack;
+  if ((HighsInt)nodes[node].domchgstack.size() != nodes[node].domchgstacksize)
+    decodedstack = decodeDomchgStack(node);
+  const std::vector<HighsDomainChange>& domchgstack =
+      decodedstack.empty() ? nodes[node].domchgstack : decodedstack;
+  HighsInt numchgs = domchgstack.size();
 
   for (HighsInt i = 0; i != numchgs; ++i) {
-    HighsInt col = nodes[node].domchgstack[i].column;
-    switch (nodes[node].domchgstack[i].boundtype) {
+    HighsInt col = domchgstack[i].column;
+    switch (domchgstack[i].boundtype) {
       case HighsBoundType::kLower:
         colLowerNodesPtr.get()[col].erase(nodes[node].domchglinks[i]);
         break;
@@ -191,24 +215,42 @@ void HighsNodeQueue::unlink_domchgs(int64_t node) {
 
   nodes[node].domchglinks.clear();
   nodes[node].domchglinks.shrink_to_fit();
+  nodes[node].domchgsegment.reset();
+}
+
+double HighsNodeQueue::nodeMemory(int64_t node) const {
+  // the domain changes are counted as if they were not shared, together
+  // with their links into the node sets. Only the domain changes are shared
+  // between nodes through their segments, while every open node keeps its
+  // own link and node set entry for each of its domain changes. The links
+  // dominate the memory of a node, which therefore still grows with its
+  // depth
+  constexpr double kBytesPerDomchg =
+      sizeof(HighsDomainChange) + sizeof(NodeSet::iterator) +
+      sizeof(std::pair<double, int64_t>) + 4 * sizeof(void*);
+  return sizeof(OpenNode) + kBytesPerDomchg * nodes[node].domchgstacksize +
+         sizeof(HighsInt) * nodes[node].branchings.size();
 }
 
-double HighsNodeQueue::link(int64_t node) {
+double HighsNodeQueue::link(int64_t node,
+                           const std::vector<HighsDomainChange>& domchgstack) {
+  memoryUsage += nodeMemory(node);
   if (nodes[node].lower_bound > optimality_limit) {
     assert(nodes[node].estimate != kHighsInf);
     nodes[node].estimate = kHighsInf;
     link_suboptimal(node);
-    link_domchgs(node);
+    link_domchgs(node, domchgstack);
     return std::ldexp(1.0, 1 - nodes[node].depth);
   }
 
   link_estim(node);
   link_lower(node);
-  link_domchgs(node);
+  link_domchgs(node, domchgstack);
   return 0.0;
 }
 
 void HighsNodeQueue::unlink(int64_t node) {
+  memoryUsage -= nodeMemory(node);
   if (nodes[node].estimate == kHighsInf) {
     unlink_suboptimal(node);
   } else {
@@ -266,7 +308,8 @@ double HighsNodeQueue::pruneInfeasibleNodes(HighsDomain& globaldomain,
                                             double feastol) {
   size_t numchgs;
 
-  HighsCDouble treeweight = 0.0;
+  HighsCDouble treeweight = reloadTreeweight;
+  reloadTreeweight = 0.0;
 
   do {
     if (globaldomain.infeasible()) break;
@@ -321,11 +364,24 @@ double HighsNodeQueue::pruneNode(int64_t nodeId) {
 }
 
 double HighsNodeQueue::performBounding(double upper_limit) {
-  NodeLowerRbTree lowerTree(this);
+  HighsCDouble treeweight = 0.0;
 
-  if (lowerTree.empty()) return 0.0;
+  if (droppedLowerBound >= upper_limit) {
+    numDropped = 0;
+    droppedLowerBound = kHighsInf;
+  }
 
-  HighsCDouble treeweight = 0.0;
+  if (numSpilled > 0 && spilledLowerBound >= upper_limit) {
+    treeweight += spilledTreeweight;
+    spillFile.reset();
+    numSpilled = 0;
+    spilledLowerBound = kHighsInf;
+    spilledTreeweight = 0.0;
+  }
+
+  NodeLowerRbTree lowerTree(this);
+
+  if (lowerTree.empty()) return double(treeweight);
 
   int64_t maxLbNode = lowerTree.last();
   while (maxLbNode != -1) {
@@ -371,14 +427,39 @@ double HighsNodeQueue::emplaceNode(std::vector<HighsDomainChange>&& domchgs,
 
   assert(estimate != kHighsInf);
 
+  // the node shares the longest common prefix with the stack of the last
+  // emplaced node, stored in the smallest segment of its chain that
+  // contains the prefix
+  HighsInt numchgs = domchgs.size();
+  HighsInt prefix = 0;
+  HighsInt maxPrefix = std::min(numchgs, (HighsInt)lastDomchgStack.size());
+  while (prefix < maxPrefix && domchgs[prefix] == lastDomchgStack[prefix])
+    ++prefix;
+  std::shared_ptr<const DomchgSegment> parent = lastSegment;
+  while (parent && parent->parentSize >= prefix) parent = parent->parent;
+  // bound the length of the chains so that decoding a stack stays cheap
+  if (parent && parent->chainLength >= kMaxSegmentChainLength) {
+    parent = nullptr;
+    prefix = 0;
+  }
+
+  std::shared_ptr<const DomchgSegment> segment;
+  if (parent && prefix == numchgs)
+    segment = std::move(parent);
+  else
+    segment = std::make_shared<const DomchgSegment>(DomchgSegment{
+        parent, prefix, parent ? parent->chainLength + 1 : 1,
+        std::vector<HighsDomainChange>(domchgs.begin() + prefix,
+                                       domchgs.end())});
+
   if (freeslots.empty()) {
     pos = nodes.size();
-    nodes.emplace_back(std::move(domchgs), std::move(branchPositions),
+    nodes.emplace_back(segment, numchgs, std::move(branchPositions),
                        lower_bound, estimate, depth);
   } else {
     pos = freeslots.top();
     freeslots.pop();
-    nodes[pos] = OpenNode(std::move(domchgs), std::move(branchPositions),
+    nodes[pos] = OpenNode(segment, numchgs, std::move(branchPositions),
                           lower_bound, estimate, depth);
   }
 
@@ -386,20 +467,170 @@ double HighsNodeQueue::emplaceNode(std::vector<HighsDomainChange>&& domchgs,
   assert(nodes[pos].estimate == estimate);
   assert(nodes[pos].depth == depth);
 
-  return link(pos);
+  assert(decodeDomchgStack(pos) == domchgs);
+  double treeweight = link(pos, domchgs);
+  lastSegment = std::move(segment);
+  lastDomchgStack = std::move(domchgs);
+
+  if (memoryUsage > memoryLimit) spillNodes();
+
+  return treeweight;
+}
+
+void HighsNodeQueue::spillNodes() {
+  const double targetUsage = 0.75 * memoryLimit;
+
+  // suboptimal nodes are only kept for their lower bound, for which the
+  // summary suffices
+  SuboptimalNodeRbTree suboptimalTree(this);
+  while (memoryUsage > targetUsage && numSuboptimal > 0) {
+    int64_t node = suboptimalTree.last();
+    ++numDropped;
+    droppedLowerBound = std::min(droppedLowerBound, nodes[node].lower_bound);
+    unlink(node);
+  }
+
+  // the best bound node and at least one other active node stay in memory
+  NodeHybridEstimRbTree estimTree(this);
+  while (memoryUsage > targetUsage &&
+         int64_t(nodes.size() - freeslots.size()) - numSuboptimal > 1) {
+    if (!spillFile) spillFile.reset(std::tmpfile());
+
+    int64_t node = estimTree.last();
+    if (node == lowerMin) node = estimTree.predecessor(node);
+    std::vector<HighsDomainChange> domchgstack = decodeDomchgStack(node);
+    const OpenNode& openNode = nodes[node];
+    HighsInt numBranchings = openNode.branchings.size();
+    std::FILE* file = spillFile.get();
+    bool written =
+        file && std::fwrite(&openNode.lower_bound, sizeof(double), 1, file) &&
+        std::fwrite(&openNode.estimate, sizeof(double), 1, file) &&
+        std::fwrite(&openNode.depth, sizeof(HighsInt), 1, file) &&
+        std::fwrite(&openNode.domchgstacksize, sizeof(HighsInt), 1, file) &&
+        std::fwrite(&numBranchings, sizeof(HighsInt), 1, file) &&
+        std::fwrite(domchgstack.data(), sizeof(HighsDomainChange),
+                    domchgstack.size(), file) == domchgstack.size() &&
+        std::fwrite(openNode.branchings.data(), sizeof(HighsInt),
+                    numBranchings, file) == (size_t)numBranchings;
+    if (!written) {
+      // without a usable temporary file the nodes are kept in memory
+      memoryLimit = kHighsInf;
+      return;
+    }
+
+    ++numSpilled;
+    ++numNodesSpilled;
+    spilledLowerBound = std::min(spilledLowerBound, openNode.lower_bound);
+    spilledTreeweight += std::ldexp(1.0, 1 - openNode.depth);
+    unlink(node);
+  }
+}
+
+bool HighsNodeQueue::readSpilledNode(std::FILE* file, OpenNode& node) {
+  HighsInt numchgs;
+  HighsInt numBranchings;
+  bool read = std::fread(&node.lower_bound, sizeof(double), 1, file) &&
+              std::fread(&node.estimate, sizeof(double), 1, file) &&
+              std::fread(&node.depth, sizeof(HighsInt), 1, file) &&
+              std::fread(&numchgs, sizeof(HighsInt), 1, file) &&
+              std::fread(&numBranchings, sizeof(HighsInt), 1, file);
+  if (!read) return false;
+  node.domchgstack.resize(numchgs);
+  node.branchings.resize(numBranchings);
+  return std::fread(node.domchgstack.data(), sizeof(HighsDomainChange),
+                    numchgs, file) == (size_t)numchgs &&
+         std::fread(node.branchings.data(), sizeof(HighsInt), numBranchings,
+                    file) == (size_t)numBranchings;
+}
+
+void HighsNodeQueue::reloadSpilledNodes() {
+  std::unique_ptr<std::FILE, FileCloser> file = std::move(spillFile);
+  const int64_t numReload = numSpilled;
+  const double reloadLowerBound = spilledLowerBound;
+  numSpilled = 0;
+  spilledLowerBound = kHighsInf;
+  spilledTreeweight = 0.0;
+
+  std::rewind(file.get());
+  for (int64_t k = 0; k < numReload; ++k) {
+    OpenNode node;
+    if (!readSpilledNode(file.get(), node)) {
+      // nodes that cannot be read back are dropped, keeping the lower
+      // bound of the spilled nodes valid
+      numDropped += numReload - k;
+      droppedLowerBound = std::min(droppedLowerBound, reloadLowerBound);
+      memoryLimit = kHighsInf;
+      return;
+    }
+
+    reloadTreeweight += emplaceNode(
+        std::move(node.domchgstack), std::move(node.branchings),
+        node.lower_bound, node.estimate, node.depth);
+    ++numNodesReloaded;
+  }
+}
+
+std::vector<HighsNodeQueue::OpenNode> HighsNodeQueue::getOpenNodes() const {
+  std::vector<uint8_t> freeSlot(nodes.size());
+  auto slots = freeslots;
+  while (!slots.empty()) {
+    freeSlot[slots.top()] = true;
+    slots.pop();
+  }
+
+  std::vector<OpenNode> openNodes;
+  for (int64_t i = 0; i < (int64_t)nodes.size(); ++i) {
+    if (freeSlot[i]) continue;
+    openNodes.emplace_back();
+    OpenNode& node = openNodes.back();
+    node.domchgstack = decodeDomchgStack(i);
+    node.branchings = nodes[i].branchings;
+    node.lower_bound = nodes[i].lower_bound;
+    // suboptimal nodes have an infinite estimate while they are queued
+    node.estimate = nodes[i].estimate == kHighsInf ? nodes[i].lower_bound
+                                                   : nodes[i].estimate;
+    node.depth = nodes[i].depth;
+  }
+
+  if (numSpilled > 0) {
+    std::FILE* file = spillFile.get();
+    std::rewind(file);
+    for (int64_t k = 0; k < numSpilled; ++k) {
+      openNodes.emplace_back();
+      if (!readSpilledNode(file, openNodes.back())) {
+        openNodes.pop_back();
+        break;
+      }
+    }
+    // further nodes are appended to the file
+    std::fseek(file, 0, SEEK_END);
+  }
+
+  return openNodes;
 }
 
 HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestNode() {
+  if (numSpilled > 0 &&
+      (hybridEstimMin == -1 || memoryUsage < 0.25 * memoryLimit))
+    reloadSpilledNodes();
+
   int64_t bestNode = hybridEstimMin;
 
+  nodes[bestNode].domchgstack = decodeDomchgStack(bestNode);
   unlink(bestNode);
 
   return std::move(nodes[bestNode]);
 }
 
 HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestBoundNode() {
+  if (numSpilled > 0 &&
+      (lowerMin == -1 || memoryUsage < 0.25 * memoryLimit ||
+       spilledLowerBound < nodes[lowerMin].lower_bound))
+    reloadSpilledNodes();
+
   int64_t bestBoundNode = lowerMin;
 
+  nodes[bestBoundNode].domchgstack = decodeDomchgStack(bestBoundNode);
   unlink(bestBoundNode);
 
   return std::move(nodes[bestBoundNode]);
@@ -407,6 +638,7 @@ HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestBoundNode() {
 
 double HighsNodeQueue::getBestLowerBound() const {
   double lb = lowerMin == -1 ? kHighsInf : nodes[lowerMin].lower_bound;
+  lb = std::min({lb, spilledLowerBound, droppedLowerBound});
 
   if (suboptimalMin == -1) return lb;
 
@@ -416,9 +648,8 @@ double HighsNodeQueue::getBestLowerBound() const {
 HighsInt HighsNodeQueue::getBestBoundDomchgStackSize() const {
   HighsInt domchgStackSize = lowerMin == -1
                                  ? kHighsIInf
-                                 : HighsInt(nodes[lowerMin].domchgstack.size());
+                                 : nodes[lowerMin].domchgstacksize;
   if (suboptimalMin == -1) return domchgStackSize;
 
-  return std::min(HighsInt(nodes[suboptimalMin].domchgstack.size()),
-                  domchgStackSize);
+  return std::min(nodes[suboptimalMin].domchgstacksize, domchgStackSize);
 }
\ No newline at end of file
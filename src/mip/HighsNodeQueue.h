@@ -16,6 +16,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdio>
 #include <memory>
 #include <queue>
 #include <set>
@@ -141,10 +142,26 @@ class HighsNodeQueue {
                            std::less<std::pair<double, int64_t>>,
                            NodesetAllocator<std::pair<double, int64_t>>>;
 
+  // Segment of a persistent tree of domain changes. The domain change
+  // stack of a segment consists of the first parentSize domain changes of
+  // its parent's stack followed by the domain changes of the segment, so
+  // that open nodes from the same dive share their common prefix
+  struct DomchgSegment {
+    std::shared_ptr<const DomchgSegment> parent;
+    HighsInt parentSize;
+    HighsInt chainLength;
+    std::vector<HighsDomainChange> domchgs;
+  };
+
   struct OpenNode {
+    // only filled when the node is popped, while in the queue the domain
+    // changes are given by the first domchgstacksize domain changes of
+    // the stack of domchgsegment
     std::vector<HighsDomainChange> domchgstack;
     std::vector<HighsInt> branchings;
     std::vector<NodeSet::iterator> domchglinks;
+    std::shared_ptr<const DomchgSegment> domchgsegment;
+    HighsInt domchgstacksize;
     double lower_bound;
     double estimate;
     HighsInt depth;
@@ -155,17 +172,21 @@ class HighsNodeQueue {
         : domchgstack(),
           branchings(),
           domchglinks(),
+          domchgsegment(),
+          domchgstacksize(0),
           lower_bound(-kHighsInf),
           estimate(-kHighsInf),
           depth(0),
           lowerLinks(),
           hybridEstimLinks() {}
 
-    OpenNode(std::vector<HighsDomainChange>&& domchgstack,
-             std::vector<HighsInt>&& branchings, double lower_bound,
-             double estimate, HighsInt depth)
-        : domchgstack(domchgstack),
-          branchings(branchings),
+    OpenNode(std::shared_ptr<const DomchgSegment> domchgsegment,
+             HighsInt domchgstacksize, std::vector<HighsInt>&& branchings,
+             double lower_bound, double estimate, HighsInt depth)
+        : domchgstack(),
+          branchings(std::move(branchings)),
+          domchgsegment(std::move(domchgsegment)),
+          domchgstacksize(domchgstacksize),
           lower_bound(lower_bound),
           estimate(estimate),
           depth(depth),
@@ -211,6 +232,41 @@ class HighsNodeQueue {
   double optimality_limit = kHighsInf;
   HighsInt numCol = 0;
 
+  // the segment and domain change stack of the most recently emplaced node,
+  // against which the next emplaced node is encoded
+  std::shared_ptr<const DomchgSegment> lastSegment;
+  std::vector<HighsDomainChange> lastDomchgStack;
+
+  enum { kMaxSegmentChainLength = 32 };
+
+  std::vector<HighsDomainChange> decodeDomchgStack(int64_t node) const;
+
+  // Once the estimated memory of the open nodes exceeds the memory limit,
+  // suboptimal nodes are dropped and the active nodes with the worst
+  // estimates are written to a temporary file. Only a summary of them is
+  // kept in memory, so that they still count for the lower bound, and they
+  // are read back once the memory of the open nodes in memory runs low
+  struct FileCloser {
+    void operator()(std::FILE* file) const { std::fclose(file); }
+  };
+  std::unique_ptr<std::FILE, FileCloser> spillFile;
+  double memoryLimit = kHighsInf;
+  double memoryUsage = 0.0;
+  int64_t numSpilled = 0;
+  double spilledLowerBound = kHighsInf;
+  double spilledTreeweight = 0.0;
+  int64_t numDropped = 0;
+  double droppedLowerBound = kHighsInf;
+  double reloadTreeweight = 0.0;
+  // totals over the lifetime of the queue, which are kept when clearing it
+  int64_t numNodesSpilled = 0;
+  int64_t numNodesReloaded = 0;
+
+  double nodeMemory(int64_t node) const;
+  void spillNodes();
+  void reloadSpilledNodes();
+  static bool readSpilledNode(std::FILE* file, OpenNode& node);
+
   void link_estim(int64_t node);
 
   void unlink_estim(int64_t node);
@@ -223,11 +279,13 @@ class HighsNodeQueue {
 
   void unlink_suboptimal(int64_t node);
 
-  void link_domchgs(int64_t node);
+  void link_domchgs(int64_t node,
+                    const std::vector<HighsDomainChange>& domchgstack);
 
   void unlink_domchgs(int64_t node);
 
-  double link(int64_t node);
+  double link(int64_t node,
+              const std::vector<HighsDomainChange>& domchgstack);
 
   void unlink(int64_t node);
 
@@ -240,6 +298,8 @@ class HighsNodeQueue {
 
   void setNumCol(HighsInt numcol);
 
+  void setMemoryLimit(double memoryLimit) { this->memoryLimit = memoryLimit; }
+
   double emplaceNode(std::vector<HighsDomainChange>&& domchgs,
                      std::vector<HighsInt>&& branchings, double lower_bound,
                      double estimate, HighsInt depth);
@@ -280,26 +340,46 @@ class HighsNodeQueue {
     return colUpperNodesPtr.get()[col];
   }
 
+  // the returned tree weight includes the nodes that were found to be
+  // suboptimal when read back from the temporary file
   double pruneInfeasibleNodes(HighsDomain& globaldomain, double feastol);
 
   double pruneNode(int64_t nodeId);
 
   double getBestLowerBound() const;
 
+  // returns a copy of all open nodes, including the nodes in the temporary
+  // file, with their domain change stacks. Nodes that were dropped as
+  // suboptimal are not included
+  std::vector<OpenNode> getOpenNodes() const;
+
   HighsInt getBestBoundDomchgStackSize() const;
 
   void clear() {
     HighsNodeQueue nodequeue;
     nodequeue.setNumCol(numCol);
+    nodequeue.setMemoryLimit(memoryLimit);
+    nodequeue.numNodesSpilled = numNodesSpilled;
+    nodequeue.numNodesReloaded = numNodesReloaded;
     *this = std::move(nodequeue);
   }
 
-  int64_t numNodes() const { return nodes.size() - freeslots.size(); }
+  int64_t numNodes() const {
+    return nodes.size() - freeslots.size() + numSpilled + numDropped;
+  }
 
+  // spilled nodes are active unless all of them are beyond the
+  // optimality limit, in which case they are found to be suboptimal when
+  // read back
   int64_t numActiveNodes() const {
-    return nodes.size() - freeslots.size() - numSuboptimal;
+    return nodes.size() - freeslots.size() - numSuboptimal +
+           (spilledLowerBound <= optimality_limit ? numSpilled : 0);
   }
 
+  int64_t getNumNodesSpilled() const { return numNodesSpilled; }
+
+  int64_t getNumNodesReloaded() const { return numNodesReloaded; }
+
   bool empty() const { return numActiveNodes() == 0; }
 };
 
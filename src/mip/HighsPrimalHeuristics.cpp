@@ -12,6 +12,7 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "mip/HighsPrimalHeuristics.h"
 
+#include <atomic>
 #include <numeric>
 #include <unordered_set>
 
@@ -22,6 +23,7 @@
 #include "mip/HighsDomainChange.h"
 #include "mip/HighsLpRelaxation.h"
 #include "mip/HighsMipSolverData.h"
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 #include "util/HighsHash.h"
 #include "util/HighsIntegers.h"
@@ -29,13 +31,48 @@
 HighsPrimalHeuristics::HighsPrimalHeuristics(HighsMipSolver& mipsolver)
     : mipsolver(mipsolver),
       lp_iterations(0),
-      randgen(mipsolver.options_mip_->random_seed) {
+      randgen(mipsolver.options_mip_->random_seed),
+      localBranchingSols(-1),
+      proximitySearchSols(-1),
+      backgroundSubMipsAllowed(false) {
   successObservations = 0;
   numSuccessObservations = 0;
   infeasObservations = 0;
   numInfeasObservations = 0;
 }
 
+struct HighsPrimalHeuristics::BackgroundSubMip {
+  HighsOptions options;
+  HighsLp lp;
+  HighsBasis basis;
+  HighsSolution solution;
+  HighsPseudocostInitialization pscostinit;
+  double fixingRate;
+  bool improvementHeuristic;
+  double syncWork;
+  std::unique_ptr<HighsMipSolver> solver;
+  std::atomic<bool> started;
+  std::atomic<bool> finished;
+  highs::parallel::TaskGroup taskGroup;
+
+  BackgroundSubMip(HighsOptions&& options, HighsLp&& lp,
+                   const HighsBasis& basis, const HighsPseudocost& pseudocost,
+                   double fixingRate, bool improvementHeuristic)
+      : options(std::move(options)),
+        lp(std::move(lp)),
+        basis(basis),
+        pscostinit(pseudocost, 1),
+        fixingRate(fixingRate),
+        improvementHeuristic(improvementHeuristic),
+        started(false),
+        finished(false) {
+    solution.value_valid = false;
+    solution.dual_valid = false;
+  }
+};
+
+HighsPrimalHeuristics::~HighsPrimalHeuristics() = default;
+
 void HighsPrimalHeuristics::setupIntCols() {
   intcols = mipsolver.mipdata_->integer_cols;
 
@@ -73,7 +110,8 @@ void HighsPrimalHeuristics::setupIntCols() {
 bool HighsPrimalHeuristics::solveSubMip(
     const HighsLp& lp, const HighsBasis& basis, double fixingRate,
     std::vector<double> colLower, std::vector<double> colUpper,
-    HighsInt maxleaves, HighsInt maxnodes, HighsInt stallnodes) {
+    HighsInt maxleaves, HighsInt maxnodes, HighsInt stallnodes,
+    bool boundObjective, bool improvementHeuristic) {
   HighsOptions submipoptions = *mipsolver.options_mip_;
   HighsLp submip = lp;
 
@@ -91,7 +129,12 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipoptions.mip_pscost_minreliable = 0;
   submipoptions.time_limit -=
       mipsolver.timer_.read(mipsolver.timer_.solve_clock);
-  submipoptions.objective_bound = mipsolver.mipdata_->upper_limit;
+  // a sub-MIP that is not bounded by the upper limit can have an objective
+  // that differs from the model, so the objective bound option does not apply
+  if (boundObjective)
+    submipoptions.objective_bound = mipsolver.mipdata_->upper_limit;
+  else
+    submipoptions.objective_bound = kHighsInf;
 
   if (!mipsolver.submip) {
     double curr_abs_gap =
@@ -110,6 +153,31 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipoptions.presolve = "on";
   submipoptions.mip_detect_symmetry = false;
   submipoptions.mip_heuristic_effort = 0.8;
+
+  // during the tree search the sub-MIP can be solved in the background, with
+  // the clique table and implications detected again by the sub-MIP
+  if (backgroundSubMipsAllowed && !backgroundSubMip) {
+    backgroundSubMip.reset(new BackgroundSubMip(
+        std::move(submipoptions), std::move(submip), basis,
+        mipsolver.mipdata_->pseudocost, fixingRate, improvementHeuristic));
+    BackgroundSubMip& subMip = *backgroundSubMip;
+    // in deterministic mode the result is collected once the search has done
+    // a fixed amount of work, rather than whenever the sub-MIP has finished
+    subMip.syncWork =
+        mipsolver.mipdata_->workUnits() +
+        double(std::max(int64_t{1000}, mipsolver.mipdata_->firstrootlpiters));
+    subMip.solver.reset(new HighsMipSolver(subMip.options, subMip.lp,
+                                           subMip.solution, true));
+    subMip.solver->rootbasis = &subMip.basis;
+    subMip.solver->pscostinit = &subMip.pscostinit;
+    subMip.taskGroup.spawn([&subMip]() {
+      subMip.started = true;
+      subMip.solver->run();
+      subMip.finished = true;
+    });
+    return true;
+  }
+
   // setup solver and run it
 
   HighsSolution solution;
@@ -122,6 +190,12 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipsolver.clqtableinit = &mipsolver.mipdata_->cliquetable;
   submipsolver.implicinit = &mipsolver.mipdata_->implications;
   submipsolver.run();
+  return processSubMipResult(submipsolver, fixingRate, improvementHeuristic);
+}
+
+bool HighsPrimalHeuristics::processSubMipResult(
+    const HighsMipSolver& submipsolver, double fixingRate,
+    bool improvementHeuristic) {
   if (submipsolver.mipdata_) {
     double numUnfixed = mipsolver.mipdata_->integral_cols.size() +
                         mipsolver.mipdata_->continuous_cols.size();
@@ -153,11 +227,38 @@ bool HighsPrimalHeuristics::solveSubMip(
     // remember fixing rate as good
     successObservations += fixingRate;
     ++numSuccessObservations;
+    if (improvementHeuristic)
+      ++mipsolver.mipdata_->num_improvement_heuristic_sols;
   }
 
   return true;
 }
 
+void HighsPrimalHeuristics::collectBackgroundSubMip(bool wait, bool cancel) {
+  if (!backgroundSubMip) return;
+
+  BackgroundSubMip& subMip = *backgroundSubMip;
+  const bool deterministic = mipsolver.options_mip_->mip_deterministic;
+  if (!wait) {
+    if (deterministic) {
+      if (mipsolver.mipdata_->workUnits() < subMip.syncWork) return;
+    } else if (subMip.started && !subMip.finished)
+      return;
+  }
+
+  if (cancel) subMip.taskGroup.cancel();
+  subMip.taskGroup.taskWait();
+  // whether a cancelled sub-MIP finished depends on the timing, so its result
+  // is discarded in deterministic mode
+  if (subMip.finished && !(cancel && deterministic)) {
+    processSubMipResult(*subMip.solver, subMip.fixingRate,
+                        subMip.improvementHeuristic);
+    ++mipsolver.mipdata_->num_background_sub_mips;
+  }
+
+  backgroundSubMip.reset();
+}
+
 double HighsPrimalHeuristics::determineTargetFixingRate() {
   double lowFixingRate = 0.6;
   double highFixingRate = 0.6;
@@ -802,8 +903,128 @@ retry:
   lp_iterations += heur.getLocalLpIterations();
 }
 
+// appends the row lower <= sum vals[k] * x[inds[k]] <= upper to the LP of a
+// sub-MIP, and to the basis given for it as a basic row
+static void addSubMipRow(HighsLp& lp, HighsBasis& basis,
+                         const std::vector<HighsInt>& inds,
+                         const std::vector<double>& vals, double lower,
+                         double upper) {
+  HighsSparseMatrix row;
+  row.format_ = MatrixFormat::kRowwise;
+  row.num_col_ = lp.num_col_;
+  row.num_row_ = 1;
+  row.start_ = {0, (HighsInt)inds.size()};
+  row.index_ = inds;
+  row.value_ = vals;
+
+  appendRowsToLpVectors(lp, 1, {lower}, {upper});
+  lp.setMatrixDimensions();
+  lp.a_matrix_.addRows(row);
+  lp.num_row_ += 1;
+
+  basis.row_status.push_back(HighsBasisStatus::kBasic);
+}
+
+void HighsPrimalHeuristics::localBranching() {
+  const std::vector<double>& incumbent = mipsolver.mipdata_->incumbent;
+  if (incumbent.empty() ||
+      localBranchingSols == mipsolver.mipdata_->numImprovingSols)
+    return;
+  localBranchingSols = mipsolver.mipdata_->numImprovingSols;
+
+  // the neighbourhood of the incumbent are the solutions that flip at most k
+  // of its binary values, expressed by the row
+  // sum_{x*_j = 0} x_j - sum_{x*_j = 1} x_j <= k - |{j : x*_j = 1}|
+  const HighsDomain& globaldom = mipsolver.mipdata_->domain;
+  std::vector<HighsInt> inds;
+  std::vector<double> vals;
+  HighsInt numOnes = 0;
+  for (HighsInt i : mipsolver.mipdata_->integer_cols) {
+    if (globaldom.col_lower_[i] != 0.0 || globaldom.col_upper_[i] != 1.0)
+      continue;
+    inds.push_back(i);
+    if (incumbent[i] < 0.5) {
+      vals.push_back(1.0);
+    } else {
+      vals.push_back(-1.0);
+      ++numOnes;
+    }
+  }
+
+  if (inds.size() < 10) return;
+
+  // the fixing rate that RINS and RENS would use determines the size of the
+  // neighbourhood, so that the statistics of all sub-MIPs adapt it
+  double fixingRate = determineTargetFixingRate();
+  double k = std::max(2.0, std::ceil(0.25 * (1.0 - fixingRate) * inds.size()));
+  fixingRate = 1.0 - k / inds.size();
+
+  HighsLp lp = *mipsolver.model_;
+  HighsBasis basis = mipsolver.mipdata_->firstrootbasis;
+  addSubMipRow(lp, basis, inds, vals, -kHighsInf, k - numOnes);
+
+  solveSubMip(lp, basis, fixingRate, globaldom.col_lower_,
+              globaldom.col_upper_, 500,
+              200 + int(0.05 * (mipsolver.mipdata_->num_nodes)), 12, true,
+              true);
+  ++mipsolver.mipdata_->num_improvement_sub_mips;
+}
+
+void HighsPrimalHeuristics::proximitySearch() {
+  const std::vector<double>& incumbent = mipsolver.mipdata_->incumbent;
+  if (incumbent.empty() ||
+      proximitySearchSols == mipsolver.mipdata_->numImprovingSols)
+    return;
+  proximitySearchSols = mipsolver.mipdata_->numImprovingSols;
+
+  // the sub-MIP minimizes the Hamming distance to the incumbent over the
+  // binary columns, subject to the objective improving by a fraction of the
+  // gap which is larger for larger fixing rates
+  const HighsDomain& globaldom = mipsolver.mipdata_->domain;
+  HighsLp lp = *mipsolver.model_;
+  lp.col_cost_.assign(lp.num_col_, 0.0);
+  HighsInt numBinaries = 0;
+  for (HighsInt i : mipsolver.mipdata_->integer_cols) {
+    if (globaldom.col_lower_[i] != 0.0 || globaldom.col_upper_[i] != 1.0)
+      continue;
+    lp.col_cost_[i] = incumbent[i] < 0.5 ? 1.0 : -1.0;
+    ++numBinaries;
+  }
+
+  if (numBinaries < 10) return;
+
+  std::vector<HighsInt> inds;
+  std::vector<double> vals;
+  for (HighsInt i = 0; i != mipsolver.numCol(); ++i) {
+    if (mipsolver.colCost(i) == 0.0) continue;
+    inds.push_back(i);
+    vals.push_back(mipsolver.colCost(i));
+  }
+
+  if (inds.empty()) return;
+
+  double upper_limit = mipsolver.mipdata_->upper_limit;
+  double gap = upper_limit - mipsolver.mipdata_->lower_bound;
+  if (gap == kHighsInf) gap = std::max(std::abs(upper_limit), 1.0);
+
+  double fixingRate = determineTargetFixingRate();
+  double cutoff = upper_limit - 0.1 * fixingRate * gap;
+
+  HighsBasis basis = mipsolver.mipdata_->firstrootbasis;
+  addSubMipRow(lp, basis, inds, vals, -kHighsInf, cutoff);
+
+  solveSubMip(lp, basis, fixingRate, globaldom.col_lower_,
+              globaldom.col_upper_, 500,
+              200 + int(0.05 * (mipsolver.mipdata_->num_nodes)), 12, false,
+              true);
+  ++mipsolver.mipdata_->num_improvement_sub_mips;
+}
+
 bool HighsPrimalHeuristics::tryRoundedPoint(const std::vector<double>& point,
                                             char source) {
+  // the global domain is infeasible once the incumbent is proven optimal
+  if (mipsolver.mipdata_->domain.infeasible()) return false;
+
   auto localdom = mipsolver.mipdata_->domain;
 
   HighsInt numintcols = intcols.size();
@@ -13,6 +13,7 @@
 #ifndef HIGHS_PRIMAL_HEURISTICS_H_
 #define HIGHS_PRIMAL_HEURISTICS_H_
 
+#include <memory>
 #include <vector>
 
 #include "lp_data/HStruct.h"
@@ -35,15 +36,50 @@ class HighsPrimalHeuristics {
 
   std::vector<HighsInt> intcols;
 
+  // number of improving solutions when local branching and proximity search
+  // were last run, so that each is tried at most once per incumbent
+  HighsInt localBranchingSols;
+  HighsInt proximitySearchSols;
+
+  // sub-MIP that is solved by a background task on a snapshot of the
+  // problem, with its result only processed by the owning thread
+  struct BackgroundSubMip;
+  std::unique_ptr<BackgroundSubMip> backgroundSubMip;
+  bool backgroundSubMipsAllowed;
+
+  bool processSubMipResult(const HighsMipSolver& submipsolver,
+                           double fixingRate, bool improvementHeuristic);
+
  public:
   HighsPrimalHeuristics(HighsMipSolver& mipsolver);
 
+  ~HighsPrimalHeuristics();
+
   void setupIntCols();
 
   bool solveSubMip(const HighsLp& lp, const HighsBasis& basis,
                    double fixingRate, std::vector<double> colLower,
                    std::vector<double> colUpper, HighsInt maxleaves,
-                   HighsInt maxnodes, HighsInt stallnodes);
+                   HighsInt maxnodes, HighsInt stallnodes,
+                   bool boundObjective = true,
+                   bool improvementHeuristic = false);
+
+  // sub-MIPs may only be spawned in the background where no task group of
+  // the calling thread holds pending tasks, which is the case in the tree
+  // search loop but not during the root node evaluation
+  void allowBackgroundSubMips(bool allowed) {
+    backgroundSubMipsAllowed = allowed;
+  }
+
+  // processes the result of the background sub-MIP if it finished, or if it
+  // was not picked up by another thread, in which case it is solved now. With
+  // wait set a running sub-MIP is waited for, and with cancel set a sub-MIP
+  // that has not started is discarded
+  void collectBackgroundSubMip(bool wait, bool cancel = false);
+
+  // whether a background sub-MIP was spawned and its result is not yet
+  // processed
+  bool backgroundSubMipPending() const { return backgroundSubMip != nullptr; }
 
   double determineTargetFixingRate();
 
@@ -53,6 +89,10 @@ class HighsPrimalHeuristics {
 
   void RINS(const std::vector<double>& relaxationsol);
 
+  void localBranching();
+
+  void proximitySearch();
+
   void feasibilityPump();
 
   void centralRounding();
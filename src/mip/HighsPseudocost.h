@@ -46,6 +46,7 @@ struct HighsPseudocostInitialization {
   int64_t nsamplestotal;
   int64_t ninferencestotal;
 
+  HighsPseudocostInitialization() = default;
   HighsPseudocostInitialization(const HighsPseudocost& pscost,
                                 HighsInt maxCount);
   HighsPseudocostInitialization(
@@ -35,6 +35,9 @@ HighsSearch::HighsSearch(HighsMipSolver& mipsolver,
   inheuristic = false;
   inbranching = false;
   countTreeWeight = true;
+  nodeSelection = HighsMipTrace::NodeSelection::kBestBound;
+  traceLpIterations = 0;
+  tracePropagationTime = 0.0;
   childselrule = mipsolver.submip ? ChildSelectionRule::kHybridInferenceCost
                                   : ChildSelectionRule::kRootSol;
   this->localdom.setDomainChangeStack(std::vector<HighsDomainChange>());
@@ -905,7 +908,9 @@ void HighsSearch::resetLocalDomain() {
 #endif
 }
 
-void HighsSearch::installNode(HighsNodeQueue::OpenNode&& node) {
+void HighsSearch::installNode(HighsNodeQueue::OpenNode&& node,
+                              HighsMipTrace::NodeSelection selection) {
+  nodeSelection = selection;
   localdom.setDomainChangeStack(node.domchgstack, node.branchings);
   bool globalSymmetriesValid = true;
   if (mipsolver.mipdata_->globalOrbits) {
@@ -943,7 +948,13 @@ HighsSearch::NodeResult HighsSearch::evaluateNode() {
       currnode.lower_bound > mipsolver.mipdata_->optimality_limit)
     return NodeResult::kSubOptimal;
 
+  const bool tracing = !inheuristic && mipsolver.trace;
+  double propagationStart =
+      tracing ? mipsolver.timer_.read(mipsolver.timer_.solve_clock) : 0.0;
   localdom.propagate();
+  if (tracing)
+    tracePropagationTime +=
+        mipsolver.timer_.read(mipsolver.timer_.solve_clock) - propagationStart;
 
   if (!inheuristic && !localdom.infeasible()) {
     if (mipsolver.mipdata_->symmetries.numPerms > 0 &&
@@ -998,6 +1009,7 @@ HighsSearch::NodeResult HighsSearch::evaluateNode() {
     int64_t oldnumiters = lp->getNumLpIterations();
     HighsLpRelaxation::Status status = lp->resolveLp(&localdom);
     lpiterations += lp->getNumLpIterations() - oldnumiters;
+    traceLpIterations += lp->getNumLpIterations() - oldnumiters;
 
     currnode.lower_bound =
         std::max(localdom.getObjectiveLowerBound(), currnode.lower_bound);
@@ -1042,7 +1054,20 @@ HighsSearch::NodeResult HighsSearch::evaluateNode() {
           if (mipsolver.mipdata_->upper_limit < cutoffbnd)
             lp->setObjectiveLimit(mipsolver.mipdata_->upper_limit);
 
-          if (lp->unscaledDualFeasible(status)) {
+          // with a solution pool the subtree can contain other solutions
+          // that enter the pool, so the node stays open for branching as
+          // long as it has an integer column that is not fixed
+          bool keepOpen = false;
+          if (!inheuristic && mipsolver.solutionPool.enabled()) {
+            for (HighsInt i : mipsolver.mipdata_->integral_cols) {
+              if (!localdom.isFixed(i)) {
+                keepOpen = true;
+                break;
+              }
+            }
+          }
+
+          if (lp->unscaledDualFeasible(status) && !keepOpen) {
             addBoundExceedingConflict();
             result = NodeResult::kBoundExceeding;
           }
@@ -1150,6 +1175,44 @@ HighsSearch::NodeResult HighsSearch::evaluateNode() {
   return result;
 }
 
+void HighsSearch::traceNode(NodeResult result) {
+  if (inheuristic || !mipsolver.trace) return;
+
+  HighsMipTrace::Node node;
+  node.depth = getCurrentDepth();
+  node.lower_bound = nodestack.back().lower_bound;
+  node.estimate = nodestack.back().estimate;
+  node.lp_iterations = traceLpIterations;
+  node.propagation_time = tracePropagationTime;
+  node.num_cuts_in_lp = lp->numRows() - mipsolver.numRow();
+  const std::vector<HighsInt>& branchPos = localdom.getBranchingPositions();
+  node.branching_col =
+      branchPos.empty()
+          ? -1
+          : localdom.getDomainChangeStack()[branchPos.back()].column;
+  node.selection = nodeSelection;
+  switch (result) {
+    case NodeResult::kBoundExceeding:
+      node.result = HighsMipTrace::NodeResult::kBoundExceeding;
+      break;
+    case NodeResult::kDomainInfeasible:
+      node.result = HighsMipTrace::NodeResult::kDomainInfeasible;
+      break;
+    case NodeResult::kLpInfeasible:
+      node.result = HighsMipTrace::NodeResult::kLpInfeasible;
+      break;
+    case NodeResult::kSubOptimal:
+      node.result = HighsMipTrace::NodeResult::kSuboptimal;
+      break;
+    default:
+      node.result = HighsMipTrace::NodeResult::kOpen;
+  }
+  mipsolver.trace->addNode(node);
+
+  traceLpIterations = 0;
+  tracePropagationTime = 0.0;
+}
+
 HighsSearch::NodeResult HighsSearch::branch() {
   assert(localdom.getChangedCols().empty());
 
@@ -1386,6 +1449,7 @@ HighsSearch::NodeResult HighsSearch::branch() {
         }
       }
       result = NodeResult::kBranched;
+      nodeSelection = HighsMipTrace::NodeSelection::kChild;
       break;
     }
 
@@ -1639,6 +1703,7 @@ bool HighsSearch::backtrack(bool recoverBasis) {
     lp->recoverBasis();
   }
 
+  nodeSelection = HighsMipTrace::NodeSelection::kBacktrack;
   return true;
 }
 
@@ -1819,6 +1884,7 @@ bool HighsSearch::backtrackPlunge(HighsNodeQueue& nodequeue) {
     lp->recoverBasis();
   }
 
+  nodeSelection = HighsMipTrace::NodeSelection::kPlunge;
   return true;
 }
 
@@ -1892,6 +1958,7 @@ HighsSearch::NodeResult HighsSearch::dive() {
   do {
     ++nnodes;
     NodeResult result = evaluateNode();
+    traceNode(result);
 
     if (mipsolver.mipdata_->checkLimits(nnodes)) return result;
 
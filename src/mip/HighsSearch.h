@@ -21,6 +21,7 @@
 #include "mip/HighsDomain.h"
 #include "mip/HighsLpRelaxation.h"
 #include "mip/HighsMipSolver.h"
+#include "mip/HighsMipTrace.h"
 #include "mip/HighsNodeQueue.h"
 #include "mip/HighsPseudocost.h"
 #include "mip/HighsSeparation.h"
@@ -48,6 +49,11 @@ class HighsSearch {
   bool inbranching;
   bool inheuristic;
   bool countTreeWeight;
+  // how the current node was selected, and the LP iterations and propagation
+  // time spent on it since it was last recorded in the MIP trace
+  HighsMipTrace::NodeSelection nodeSelection;
+  int64_t traceLpIterations;
+  double tracePropagationTime;
 
  public:
   enum class ChildSelectionRule {
@@ -201,7 +207,8 @@ class HighsSearch {
 
   void flushStatistics();
 
-  void installNode(HighsNodeQueue::OpenNode&& node);
+  void installNode(HighsNodeQueue::OpenNode&& node,
+                   HighsMipTrace::NodeSelection selection);
 
   void addInfeasibleConflict();
 
@@ -214,6 +221,9 @@ class HighsSearch {
 
   NodeResult evaluateNode();
 
+  // writes a record for the current node to the MIP trace, if there is one
+  void traceNode(NodeResult result);
+
   NodeResult branch();
 
   /// backtrack one level in DFS manner
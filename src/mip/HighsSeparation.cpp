@@ -110,12 +110,51 @@ HighsInt HighsSeparation::separationRound(HighsDomain& propdomain,
   }
   HighsLpAggregator lpAggregator(*lp);
 
-  for (const std::unique_ptr<HighsSeparator>& separator : separators) {
-    separator->run(*lp, lpAggregator, transLp, mipdata.cutpool);
+  // each separator scans the rows of the LP, which is counted here rather
+  // than by the separators as they may run concurrently
+  mipdata.separation_steps += int64_t(separators.size()) * lp->numRows();
+
+  if (mipdata.mipsolver.options_mip_->mip_parallel_separation) {
+    // The tableau separator uses the LP solver and runs on this thread,
+    // while the other separators run as tasks, each with its own
+    // transformed LP and aggregator as both are modified when separating.
+    // Their cuts are collected by the cut pool in a concurrent epoch
+    const HighsInt numTasks = separators.size() - 1;
+    std::vector<std::unique_ptr<HighsTransformedLp>> taskTransLps;
+    std::vector<std::unique_ptr<HighsLpAggregator>> taskAggregators;
+    for (HighsInt i = 0; i < numTasks; ++i) {
+      taskTransLps.emplace_back(
+          new HighsTransformedLp(*lp, mipdata.implications));
+      taskAggregators.emplace_back(new HighsLpAggregator(*lp));
+    }
     if (mipdata.domain.infeasible()) {
       status = HighsLpRelaxation::Status::kInfeasible;
       return 0;
     }
+
+    mipdata.cutpool.beginConcurrentEpoch();
+    highs::parallel::TaskGroup tg;
+    for (HighsInt i = 0; i < numTasks; ++i)
+      tg.spawn([&, i]() {
+        separators[i + 1]->run(*lp, *taskAggregators[i], *taskTransLps[i],
+                               mipdata.cutpool);
+      });
+    separators[0]->run(*lp, lpAggregator, transLp, mipdata.cutpool);
+    tg.taskWait();
+    mipdata.num_parallel_separation_cuts +=
+        mipdata.cutpool.commitPendingCuts(mipdata.mipsolver);
+    if (mipdata.domain.infeasible()) {
+      status = HighsLpRelaxation::Status::kInfeasible;
+      return 0;
+    }
+  } else {
+    for (const std::unique_ptr<HighsSeparator>& separator : separators) {
+      separator->run(*lp, lpAggregator, transLp, mipdata.cutpool);
+      if (mipdata.domain.infeasible()) {
+        status = HighsLpRelaxation::Status::kInfeasible;
+        return 0;
+      }
+    }
   }
 
   numboundchgs = propagateAndResolve();
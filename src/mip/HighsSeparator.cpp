@@ -20,7 +20,7 @@
 
 HighsSeparator::HighsSeparator(const HighsMipSolver& mipsolver,
                                const char* name, const char* ch3_name)
-    : numCutsFound(0), numCalls(0) {
+    : numCalls(0) {
   clockIndex = mipsolver.timer_.clock_def(name, ch3_name);
 }
 
@@ -28,11 +28,8 @@ void HighsSeparator::run(HighsLpRelaxation& lpRelaxation,
                          HighsLpAggregator& lpAggregator,
                          HighsTransformedLp& transLp, HighsCutPool& cutpool) {
   ++numCalls;
-  HighsInt currNumCuts = cutpool.getNumCuts();
 
   lpRelaxation.getMipSolver().timer_.start(clockIndex);
   separateLpSolution(lpRelaxation, lpAggregator, transLp, cutpool);
   lpRelaxation.getMipSolver().timer_.stop(clockIndex);
-
-  numCutsFound += cutpool.getNumCuts() - currNumCuts;
 }
@@ -30,7 +30,6 @@ class HighsMipSolver;
 /// relaxation by substituting bounds and aggregating rows
 class HighsSeparator {
  private:
-  HighsInt numCutsFound;
   HighsInt numCalls;
   int clockIndex;
 
@@ -46,8 +45,6 @@ class HighsSeparator {
   void run(HighsLpRelaxation& lpRelaxation, HighsLpAggregator& lpAggregator,
            HighsTransformedLp& transLp, HighsCutPool& cutpool);
 
-  HighsInt getNumCutsFound() const { return numCutsFound; }
-
   HighsInt getNumCalls() const { return numCalls; }
 
   HighsInt getClockIndex() const { return clockIndex; }
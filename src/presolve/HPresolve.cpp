@@ -45,6 +45,16 @@
     if (__result != presolve::HPresolve::Result::kOk) return __result; \
   } while (0)
 
+#define HPRESOLVE_PROFILED_CALL(routineType, presolveCall)              \
+  do {                                                                 \
+    analysis_.startPresolveRoutineProfile(routineType, numNonzeros(),  \
+                                          numFillin);                  \
+    HPresolve::Result __result = presolveCall;                         \
+    analysis_.stopPresolveRoutineProfile(routineType, numNonzeros(),   \
+                                         numFillin);                   \
+    if (__result != presolve::HPresolve::Result::kOk) return __result; \
+  } while (0)
+
 namespace presolve {
 
 #ifndef NDEBUG
@@ -118,6 +128,7 @@ void HPresolve::setInput(HighsLp& model_, const HighsOptions& options_,
   changedColIndices.reserve(model->num_col_);
   numDeletedCols = 0;
   numDeletedRows = 0;
+  numFillin = 0;
   reductionLimit = std::numeric_limits<size_t>::max();
 }
 
@@ -1373,6 +1384,9 @@ HPresolve::Result HPresolve::runProbing(HighsPostsolveStack& postsolve_stack) {
 
         if (probingContingent - numProbed < 0) break;
 
+        if (analysis_.presolveRoutineTimeLimitReached(kPresolveRoutineProbing))
+          break;
+
         HighsInt numBoundChgs = 0;
         HighsInt numNewCliques = -cliquetable.numCliques();
         if (!implications.runProbing(i, numBoundChgs)) continue;
@@ -1505,6 +1519,7 @@ void HPresolve::addToMatrix(HighsInt row, HighsInt col, double val) {
     }
 
     link(pos);
+    ++numFillin;
   } else {
     double sum = Avalue[pos] + val;
     if (std::abs(sum) <= options->small_matrix_value) {
@@ -3923,15 +3938,20 @@ HPresolve::Result HPresolve::fastPresolveLoop(
   do {
     storeCurrentProblemSize();
 
-    HPRESOLVE_CHECKED_CALL(removeRowSingletons(postsolve_stack));
+    HPRESOLVE_PROFILED_CALL(kPresolveRoutineRowSingletons,
+                            removeRowSingletons(postsolve_stack));
 
-    HPRESOLVE_CHECKED_CALL(presolveChangedRows(postsolve_stack));
+    HPRESOLVE_PROFILED_CALL(kPresolveRoutineChangedRows,
+                            presolveChangedRows(postsolve_stack));
 
-    HPRESOLVE_CHECKED_CALL(removeDoubletonEquations(postsolve_stack));
+    HPRESOLVE_PROFILED_CALL(kPresolveRoutineDoubletonEquations,
+                            removeDoubletonEquations(postsolve_stack));
 
-    HPRESOLVE_CHECKED_CALL(presolveColSingletons(postsolve_stack));
+    HPRESOLVE_PROFILED_CALL(kPresolveRoutineColSingletons,
+                            presolveColSingletons(postsolve_stack));
 
-    HPRESOLVE_CHECKED_CALL(presolveChangedCols(postsolve_stack));
+    HPRESOLVE_PROFILED_CALL(kPresolveRoutineChangedCols,
+                            presolveChangedCols(postsolve_stack));
 
   } while (problemSizeReduction() > 0.01);
 
@@ -3997,7 +4017,8 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
       }
     };
 
-    HPRESOLVE_CHECKED_CALL(initialRowAndColPresolve(postsolve_stack));
+    HPRESOLVE_PROFILED_CALL(kPresolveRoutineInitialRowAndColPresolve,
+                            initialRowAndColPresolve(postsolve_stack));
 
     HighsInt numParallelRowColCalls = 0;
 #if ENABLE_SPARSIFY_FOR_LP
@@ -4027,18 +4048,23 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
       // structure may contain substitutions which we apply directly before
       // running the aggregator as they might loose validity otherwise
       if (mipsolver != nullptr) {
-        HPRESOLVE_CHECKED_CALL(
+        HPRESOLVE_PROFILED_CALL(
+            kPresolveRoutineConflictGraphSubstitutions,
             applyConflictGraphSubstitutions(postsolve_stack));
       }
 
-      if (analysis_.allow_rule_[kPresolveRuleAggregator])
-        HPRESOLVE_CHECKED_CALL(aggregator(postsolve_stack));
+      if (analysis_.allow_rule_[kPresolveRuleAggregator] &&
+          analysis_.allowPresolveRoutine(kPresolveRoutineAggregator))
+        HPRESOLVE_PROFILED_CALL(kPresolveRoutineAggregator,
+                                aggregator(postsolve_stack));
 
       if (problemSizeReduction() > 0.05) continue;
 
-      if (trySparsify) {
+      if (trySparsify &&
+          analysis_.allowPresolveRoutine(kPresolveRoutineSparsify)) {
         HighsInt numNz = numNonzeros();
-        HPRESOLVE_CHECKED_CALL(sparsify(postsolve_stack));
+        HPRESOLVE_PROFILED_CALL(kPresolveRoutineSparsify,
+                                sparsify(postsolve_stack));
         double nzReduction = 100.0 * (1.0 - (numNonzeros() / (double)numNz));
 
         if (nzReduction > 0) {
@@ -4051,6 +4077,7 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
       }
 
       if (analysis_.allow_rule_[kPresolveRuleParallelRowsAndCols] &&
+          analysis_.allowPresolveRoutine(kPresolveRoutineParallelRowsAndCols) &&
           numParallelRowColCalls < 5) {
         if (shrinkProblemEnabled && (numDeletedCols >= 0.5 * model->num_col_ ||
                                      numDeletedRows >= 0.5 * model->num_row_)) {
@@ -4062,7 +4089,8 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
                   model->a_matrix_.start_);
         }
         storeCurrentProblemSize();
-        HPRESOLVE_CHECKED_CALL(detectParallelRowsAndCols(postsolve_stack));
+        HPRESOLVE_PROFILED_CALL(kPresolveRoutineParallelRowsAndCols,
+                                detectParallelRowsAndCols(postsolve_stack));
         ++numParallelRowColCalls;
         if (problemSizeReduction() > 0.05) continue;
       }
@@ -4070,7 +4098,11 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
       HPRESOLVE_CHECKED_CALL(fastPresolveLoop(postsolve_stack));
 
       if (mipsolver != nullptr) {
+        analysis_.startPresolveRoutineProfile(
+            kPresolveRoutineStrengthenInequalities, numNonzeros(), numFillin);
         HighsInt numStrenghtened = strengthenInequalities();
+        analysis_.stopPresolveRoutineProfile(
+            kPresolveRoutineStrengthenInequalities, numNonzeros(), numFillin);
         if (numStrenghtened > 0)
           highsLogDev(options->log_options, HighsLogType::kInfo,
                       "Strengthened %" HIGHSINT_FORMAT " coefficients\n",
@@ -4081,17 +4113,22 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
 
       if (mipsolver != nullptr && numCliquesBeforeProbing == -1) {
         numCliquesBeforeProbing = mipsolver->mipdata_->cliquetable.numCliques();
-        storeCurrentProblemSize();
-        HPRESOLVE_CHECKED_CALL(dominatedColumns(postsolve_stack));
-        if (problemSizeReduction() > 0.0)
-          HPRESOLVE_CHECKED_CALL(fastPresolveLoop(postsolve_stack));
-        if (problemSizeReduction() > 0.05) continue;
+        if (analysis_.allowPresolveRoutine(kPresolveRoutineDominatedColumns)) {
+          storeCurrentProblemSize();
+          HPRESOLVE_PROFILED_CALL(kPresolveRoutineDominatedColumns,
+                                  dominatedColumns(postsolve_stack));
+          if (problemSizeReduction() > 0.0)
+            HPRESOLVE_CHECKED_CALL(fastPresolveLoop(postsolve_stack));
+          if (problemSizeReduction() > 0.05) continue;
+        }
       }
 
-      if (tryProbing) {
+      if (tryProbing &&
+          analysis_.allowPresolveRoutine(kPresolveRoutineProbing)) {
         detectImpliedIntegers();
         storeCurrentProblemSize();
-        HPRESOLVE_CHECKED_CALL(runProbing(postsolve_stack));
+        HPRESOLVE_PROFILED_CALL(kPresolveRoutineProbing,
+                                runProbing(postsolve_stack));
         tryProbing = probingContingent > numProbed &&
                      (problemSizeReduction() > 1.0 || probingEarlyAbort);
         trySparsify = true;
@@ -4110,22 +4147,28 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
                   model->a_matrix_.start_);
         }
         storeCurrentProblemSize();
-        if (analysis_.allow_rule_[kPresolveRuleDependentEquations]) {
-          HPRESOLVE_CHECKED_CALL(removeDependentEquations(postsolve_stack));
+        if (analysis_.allow_rule_[kPresolveRuleDependentEquations] &&
+            analysis_.allowPresolveRoutine(
+                kPresolveRoutineDependentEquations)) {
+          HPRESOLVE_PROFILED_CALL(kPresolveRoutineDependentEquations,
+                                  removeDependentEquations(postsolve_stack));
           dependentEquationsCalled = true;
         }
         if (analysis_.allow_rule_[kPresolveRuleDependentFreeCols])
-          HPRESOLVE_CHECKED_CALL(removeDependentFreeCols(postsolve_stack));
+          HPRESOLVE_PROFILED_CALL(kPresolveRoutineDependentFreeCols,
+                                  removeDependentFreeCols(postsolve_stack));
         if (problemSizeReduction() > 0.05) continue;
       }
 
       if (mipsolver != nullptr &&
           mipsolver->mipdata_->cliquetable.numCliques() >
               numCliquesBeforeProbing &&
-          !domcolAfterProbingCalled) {
+          !domcolAfterProbingCalled &&
+          analysis_.allowPresolveRoutine(kPresolveRoutineDominatedColumns)) {
         domcolAfterProbingCalled = true;
         storeCurrentProblemSize();
-        HPRESOLVE_CHECKED_CALL(dominatedColumns(postsolve_stack));
+        HPRESOLVE_PROFILED_CALL(kPresolveRoutineDominatedColumns,
+                                dominatedColumns(postsolve_stack));
         if (problemSizeReduction() > 0.0)
           HPRESOLVE_CHECKED_CALL(fastPresolveLoop(postsolve_stack));
         if (problemSizeReduction() > 0.05) continue;
@@ -4179,7 +4222,18 @@ double HPresolve::problemSizeReduction() {
 
 HighsModelStatus HPresolve::run(HighsPostsolveStack& postsolve_stack) {
   shrinkProblemEnabled = true;
-  switch (presolve(postsolve_stack)) {
+  const Result presolve_result = presolve(postsolve_stack);
+  // Report the profile of the presolve routines, and possibly write it
+  // to a file, whether or not presolve returned early. The file is only
+  // written for the presolve of the model passed to HiGHS, and not by
+  // sub-MIPs or MIP restarts, whose options are copies
+  analysis_.reportPresolveRoutineProfile();
+  const bool top_level_presolve =
+      mipsolver == nullptr ||
+      (!mipsolver->submip && mipsolver->mipdata_->numRestarts == 0);
+  if (top_level_presolve && !options->presolve_profile_file.empty())
+    analysis_.writePresolveRoutineProfile(options->presolve_profile_file);
+  switch (presolve_result) {
     case Result::kStopped:
     case Result::kOk:
       break;
@@ -4288,36 +4342,92 @@ HPresolve::Result HPresolve::removeDependentEquations(
   if (logging_on)
     analysis_.startPresolveRuleLog(kPresolveRuleDependentEquations);
 
+  // An equation with a nonzero in a column that has no nonzero in any
+  // other candidate equation cannot be part of a linear dependency, so it
+  // is discarded before the factorization. Discarding an equation may
+  // leave further columns with a single candidate equation, so this is
+  // repeated until no such column remains
+  std::vector<uint8_t> isCandidateEq(model->num_row_, false);
+  std::vector<HighsInt> numCandidateEqs(model->num_col_, 0);
+  for (const std::pair<HighsInt, HighsInt>& p : equations) {
+    isCandidateEq[p.second] = true;
+    for (const HighsSliceNonzero& nonz : getRowVector(p.second))
+      ++numCandidateEqs[nonz.index()];
+  }
+  std::vector<HighsInt> singletonCols;
+  for (HighsInt col = 0; col < model->num_col_; ++col)
+    if (numCandidateEqs[col] == 1) singletonCols.push_back(col);
+
+  HighsInt num_independent_eq = 0;
+  while (!singletonCols.empty()) {
+    HighsInt col = singletonCols.back();
+    singletonCols.pop_back();
+    if (numCandidateEqs[col] != 1) continue;
+    HighsInt eq = -1;
+    for (const HighsSliceNonzero& nonz : getColumnVector(col)) {
+      if (isCandidateEq[nonz.index()]) {
+        eq = nonz.index();
+        break;
+      }
+    }
+    assert(eq != -1);
+    isCandidateEq[eq] = false;
+    ++num_independent_eq;
+    for (const HighsSliceNonzero& nonz : getRowVector(eq))
+      if (--numCandidateEqs[nonz.index()] == 1)
+        singletonCols.push_back(nonz.index());
+  }
+
+  std::vector<HighsInt> eqSet;
+  eqSet.reserve(equations.size() - num_independent_eq);
+  for (const std::pair<HighsInt, HighsInt>& p : equations)
+    if (isCandidateEq[p.second]) eqSet.push_back(p.second);
+
+  if (eqSet.empty()) {
+    highsLogDev(options->log_options, HighsLogType::kInfo,
+                "HPresolve::removeDependentEquations All %d equations are "
+                "independent\n",
+                (int)num_independent_eq);
+    analysis_.logging_on_ = logging_on;
+    if (logging_on)
+      analysis_.stopPresolveRuleLog(kPresolveRuleDependentEquations);
+    return Result::kOk;
+  }
+
+  // The rows of the transposed matrix that is factorized are restricted
+  // to the columns with a nonzero in a remaining candidate equation, plus
+  // one for the artificial rhs column
+  std::vector<HighsInt> colIndex(model->num_col_, -1);
+  HighsInt num_factor_row = 0;
+  for (HighsInt col = 0; col < model->num_col_; ++col)
+    if (numCandidateEqs[col] > 0) colIndex[col] = num_factor_row++;
+
   HighsSparseMatrix matrix;
-  matrix.num_col_ = equations.size();
-  // printf("got %d equations, checking for dependent equations\n",
-  //        (int)matrix.num_col_);
-  matrix.num_row_ = model->num_col_ + 1;
+  matrix.num_col_ = eqSet.size();
+  matrix.num_row_ = num_factor_row + 1;
   matrix.start_.resize(matrix.num_col_ + 1);
   matrix.start_[0] = 0;
-  const HighsInt maxCapacity = numNonzeros() + matrix.num_col_;
+  HighsInt maxCapacity = matrix.num_col_;
+  for (HighsInt eq : eqSet) maxCapacity += rowsize[eq];
   matrix.value_.reserve(maxCapacity);
   matrix.index_.reserve(maxCapacity);
 
-  std::vector<HighsInt> eqSet(matrix.num_col_);
-  HighsInt i = 0;
-  for (const std::pair<HighsInt, HighsInt>& p : equations) {
-    HighsInt eq = p.second;
-    eqSet[i++] = eq;
+  for (HighsInt i = 0; i < matrix.num_col_; ++i) {
+    HighsInt eq = eqSet[i];
 
     // add entries of equation
     for (const HighsSliceNonzero& nonz : getRowVector(eq)) {
       matrix.value_.push_back(nonz.value());
-      matrix.index_.push_back(nonz.index());
+      matrix.index_.push_back(colIndex[nonz.index()]);
     }
 
     // add entry for artifical rhs column
     if (model->row_lower_[eq] != 0.0) {
       matrix.value_.push_back(model->row_lower_[eq]);
-      matrix.index_.push_back(model->num_col_);
+      matrix.index_.push_back(num_factor_row);
     }
 
-    matrix.start_[i] = matrix.value_.size();
+    matrix.start_[i + 1] = matrix.value_.size();
   }
   std::vector<HighsInt> colSet(matrix.num_col_);
   std::iota(colSet.begin(), colSet.end(), 0);
@@ -4347,6 +4457,10 @@ HPresolve::Result HPresolve::removeDependentEquations(
     highsLogDev(options->log_options, HighsLogType::kInfo,
                 ", avoiding %d fictitious rows",
                 (int)num_fictitious_rows_skipped);
+  if (num_independent_eq)
+    highsLogDev(options->log_options, HighsLogType::kInfo,
+                ", %d equations independent without factorization",
+                (int)num_independent_eq);
   highsLogDev(options->log_options, HighsLogType::kInfo, "\n");
 
   analysis_.logging_on_ = logging_on;
@@ -125,6 +125,9 @@ class HPresolve {
   HighsInt numDeletedRows;
   HighsInt numDeletedCols;
 
+  // counter for the number of nonzeros created by fill-in
+  HighsInt numFillin;
+
   // store old problem sizes to compute percentage reductions in
   // presolve loop
   HighsInt oldNumCol;
@@ -13,6 +13,36 @@
 #include "lp_data/HighsModelUtils.h"
 #include "presolve/HPresolve.h"
 
+static std::string presolveProfileJsonString(const std::string& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (const char c : value) {
+    switch (c) {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      case '\t':
+        escaped += "\\t";
+        break;
+      default:
+        if ((unsigned char)c < 0x20) {
+          char code[8];
+          snprintf(code, sizeof(code), "\\u%04x", (unsigned)c);
+          escaped += code;
+        } else {
+          escaped += c;
+        }
+    }
+  }
+  return escaped;
+}
+
 void HPresolveAnalysis::setup(const HighsLp* model_,
                               const HighsOptions* options_,
                               const HighsInt& numDeletedRows_,
@@ -46,10 +76,67 @@ void HPresolveAnalysis::setup(const HighsLp* model_,
       bit *= 2;
     }
   }
+  this->allow_routine_.assign(kPresolveRoutineCount, true);
+
+  if (options->presolve_routine_off) {
+    // Some presolve routines are off
+    highsLogUser(options->log_options, HighsLogType::kInfo,
+                 "Presolve routines not allowed:\n");
+    HighsInt bit = 1;
+    for (HighsInt routine_type = kPresolveRoutineFirstAllowOff;
+         routine_type < kPresolveRoutineCount; routine_type++) {
+      if (options->presolve_routine_off & bit) {
+        allow_routine_[routine_type] = false;
+        highsLogUser(options->log_options, HighsLogType::kInfo,
+                     "   Routine %2" HIGHSINT_FORMAT " (bit %4" HIGHSINT_FORMAT
+                     "): %s\n",
+                     routine_type, bit,
+                     utilPresolveRoutineTypeToString(routine_type).c_str());
+      }
+      bit *= 2;
+    }
+  }
+  // The budget of each routine that can be switched off
+  routine_time_limit_.assign(kPresolveRoutineCount, kHighsInf);
+  routine_call_limit_.assign(kPresolveRoutineCount, kHighsIInf);
+  routine_time_limit_[kPresolveRoutineAggregator] =
+      options->presolve_aggregator_time_limit;
+  routine_call_limit_[kPresolveRoutineAggregator] =
+      options->presolve_aggregator_call_limit;
+  routine_time_limit_[kPresolveRoutineSparsify] =
+      options->presolve_sparsify_time_limit;
+  routine_call_limit_[kPresolveRoutineSparsify] =
+      options->presolve_sparsify_call_limit;
+  routine_time_limit_[kPresolveRoutineParallelRowsAndCols] =
+      options->presolve_parallel_rows_cols_time_limit;
+  routine_call_limit_[kPresolveRoutineParallelRowsAndCols] =
+      options->presolve_parallel_rows_cols_call_limit;
+  routine_time_limit_[kPresolveRoutineDominatedColumns] =
+      options->presolve_dominated_cols_time_limit;
+  routine_call_limit_[kPresolveRoutineDominatedColumns] =
+      options->presolve_dominated_cols_call_limit;
+  routine_time_limit_[kPresolveRoutineProbing] =
+      options->presolve_probing_time_limit;
+  routine_call_limit_[kPresolveRoutineProbing] =
+      options->presolve_probing_call_limit;
+  routine_time_limit_[kPresolveRoutineDependentEquations] =
+      options->presolve_dependent_equations_time_limit;
+  routine_call_limit_[kPresolveRoutineDependentEquations] =
+      options->presolve_dependent_equations_call_limit;
   // Allow logging if option is set and model is not a MIP
   allow_logging_ = options_->presolve_rule_logging && !model_->isMip();
   logging_on_ = allow_logging_;
   log_rule_type_ = kPresolveRuleIllegal;
+  profile_routine_type_ = kPresolveRoutineIllegal;
+  // Each routine in the main presolve loop is timed by its own clock
+  if (profile_clock_.empty()) {
+    profile_clock_.resize(kPresolveRoutineCount);
+    for (HighsInt routine_type = kPresolveRoutineMin;
+         routine_type < kPresolveRoutineCount; routine_type++)
+      profile_clock_[routine_type] = profile_timer_.clock_def(
+          utilPresolveRoutineTypeToString(routine_type).c_str());
+  }
+  profile_timer_.zeroAllClocks();
   resetNumDeleted();
   presolve_log_.clear();
   original_num_col_ = model->num_col_;
@@ -63,6 +150,16 @@ void HighsPresolveLog::clear() {
     this->rule[rule_type].col_removed = 0;
     this->rule[rule_type].row_removed = 0;
   }
+  this->routine.resize(kPresolveRoutineCount);
+  for (HighsInt routine_type = 0; routine_type < kPresolveRoutineCount;
+       routine_type++) {
+    this->routine[routine_type].call = 0;
+    this->routine[routine_type].time = 0;
+    this->routine[routine_type].row_removed = 0;
+    this->routine[routine_type].col_removed = 0;
+    this->routine[routine_type].nnz_removed = 0;
+    this->routine[routine_type].fill_in = 0;
+  }
 }
 
 void HPresolveAnalysis::resetNumDeleted() {
@@ -219,3 +316,158 @@ bool HPresolveAnalysis::analysePresolveRuleLog(const bool report) {
   }
   return true;
 }
+
+void HPresolveAnalysis::startPresolveRoutineProfile(
+    const HighsInt routine_type, const HighsInt num_nonzeros,
+    const HighsInt num_fill_in) {
+  assert(routine_type >= kPresolveRoutineMin &&
+         routine_type <= kPresolveRoutineMax);
+  // Routines in the main presolve loop are not nested
+  assert(profile_routine_type_ == kPresolveRoutineIllegal);
+  profile_routine_type_ = routine_type;
+  // Record the number of remaining rows and columns, since these are
+  // not changed if the routine shrinks the problem
+  profile_num_row0_ = model->num_row_ - *numDeletedRows;
+  profile_num_col0_ = model->num_col_ - *numDeletedCols;
+  profile_num_nonzeros0_ = num_nonzeros;
+  profile_num_fill_in0_ = num_fill_in;
+  profile_timer_.start(profile_clock_[routine_type]);
+}
+
+void HPresolveAnalysis::stopPresolveRoutineProfile(
+    const HighsInt routine_type, const HighsInt num_nonzeros,
+    const HighsInt num_fill_in) {
+  assert(routine_type == profile_routine_type_);
+  HighsPresolveRoutineProfile& profile = presolve_log_.routine[routine_type];
+  const HighsInt clock = profile_clock_[routine_type];
+  profile_timer_.stop(clock);
+  const double call_time = profile_timer_.read(clock) - profile.time;
+  profile.call++;
+  profile.time = profile_timer_.read(clock);
+  const HighsInt num_removed_row =
+      profile_num_row0_ - (model->num_row_ - *numDeletedRows);
+  const HighsInt num_removed_col =
+      profile_num_col0_ - (model->num_col_ - *numDeletedCols);
+  profile.row_removed += num_removed_row;
+  profile.col_removed += num_removed_col;
+  // Nonzeros created by the routine are counted as fill-in, so the
+  // number removed is the net reduction plus the fill-in
+  const HighsInt fill_in = num_fill_in - profile_num_fill_in0_;
+  const HighsInt num_removed_nnz =
+      profile_num_nonzeros0_ - num_nonzeros + fill_in;
+  profile.nnz_removed += num_removed_nnz;
+  profile.fill_in += fill_in;
+  profile_routine_type_ = kPresolveRoutineIllegal;
+
+  // Don't call a routine that can be switched off again if its rate of
+  // reduction in the call just completed is too low. The reduction is
+  // measured by the nonzeros removed, which also accounts for the rows
+  // and columns removed, since routines such as sparsify only remove
+  // nonzeros. Calls that are too fast to be timed reliably aren't
+  // assessed
+  const double min_nnz_removal_rate =
+      options->presolve_routine_min_nnz_removal_rate;
+  const double min_assessed_call_time = 1e-3;
+  if (routine_type < kPresolveRoutineFirstAllowOff ||
+      min_nnz_removal_rate <= 0 || call_time < min_assessed_call_time)
+    return;
+  const double nnz_removal_rate = num_removed_nnz / call_time;
+  if (nnz_removal_rate < min_nnz_removal_rate) {
+    highsLogDev(options->log_options, HighsLogType::kInfo,
+                "Presolve routine \"%s\" removed %g nonzeros per second, so "
+                "is switched off\n",
+                utilPresolveRoutineTypeToString(routine_type).c_str(),
+                nnz_removal_rate);
+    allow_routine_[routine_type] = false;
+  }
+}
+
+bool HPresolveAnalysis::allowPresolveRoutine(
+    const HighsInt routine_type) const {
+  assert(routine_type >= kPresolveRoutineFirstAllowOff &&
+         routine_type <= kPresolveRoutineLastAllowOff);
+  const HighsPresolveRoutineProfile& profile =
+      presolve_log_.routine[routine_type];
+  return allow_routine_[routine_type] &&
+         profile.call < routine_call_limit_[routine_type] &&
+         profile.time < routine_time_limit_[routine_type];
+}
+
+bool HPresolveAnalysis::presolveRoutineTimeLimitReached(
+    const HighsInt routine_type) {
+  if (routine_time_limit_[routine_type] == kHighsInf) return false;
+  assert(routine_type == profile_routine_type_);
+  return profile_timer_.read(profile_clock_[routine_type]) >=
+         routine_time_limit_[routine_type];
+}
+
+void HPresolveAnalysis::reportPresolveRoutineProfile() {
+  const HighsLogOptions& log_options = options->log_options;
+  double sum_time = 0;
+  for (HighsInt routine_type = kPresolveRoutineMin;
+       routine_type < kPresolveRoutineCount; routine_type++)
+    sum_time += presolve_log_.routine[routine_type].time;
+  if (sum_time <= 0) return;
+  const std::string rule =
+      "-----------------------------------------------------------------------"
+      "----------------";
+  highsLogDev(log_options, HighsLogType::kInfo, "%s\n", rule.c_str());
+  highsLogDev(log_options, HighsLogType::kInfo,
+              "%-28s    Time     (%%)     Calls      Rows      Cols   "
+              "Nonzeros   Fill-in\n",
+              "Presolve routine");
+  highsLogDev(log_options, HighsLogType::kInfo, "%s\n", rule.c_str());
+  for (HighsInt routine_type = kPresolveRoutineMin;
+       routine_type < kPresolveRoutineCount; routine_type++) {
+    const HighsPresolveRoutineProfile& profile =
+        presolve_log_.routine[routine_type];
+    if (!profile.call) continue;
+    highsLogDev(log_options, HighsLogType::kInfo,
+                "%-28s %7.3f (%5.1f) %9" HIGHSINT_FORMAT " %9" HIGHSINT_FORMAT
+                " %9" HIGHSINT_FORMAT " %10" HIGHSINT_FORMAT
+                " %9" HIGHSINT_FORMAT "\n",
+                utilPresolveRoutineTypeToString(routine_type).c_str(),
+                profile.time, 100 * profile.time / sum_time, profile.call,
+                profile.row_removed, profile.col_removed, profile.nnz_removed,
+                profile.fill_in);
+  }
+  highsLogDev(log_options, HighsLogType::kInfo, "%s\n", rule.c_str());
+}
+
+HighsStatus HPresolveAnalysis::writePresolveRoutineProfile(
+    const std::string& filename) {
+  FILE* file = fopen(filename.c_str(), "w");
+  if (file == nullptr) {
+    highsLogUser(options->log_options, HighsLogType::kError,
+                 "Cannot open presolve profile file \"%s\"\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
+  fprintf(file, "{\n  \"model\": \"%s\",\n",
+          presolveProfileJsonString(model->model_name_).c_str());
+  fprintf(file, "  \"original_num_row\": %" HIGHSINT_FORMAT ",\n",
+          original_num_row_);
+  fprintf(file, "  \"original_num_col\": %" HIGHSINT_FORMAT ",\n",
+          original_num_col_);
+  fprintf(file, "  \"routines\": [\n");
+  for (HighsInt routine_type = kPresolveRoutineMin;
+       routine_type < kPresolveRoutineCount; routine_type++) {
+    const HighsPresolveRoutineProfile& profile =
+        presolve_log_.routine[routine_type];
+    fprintf(file,
+            "    {\"name\": \"%s\", \"call\": %" HIGHSINT_FORMAT
+            ", \"time\": %.6g, \"row_removed\": %" HIGHSINT_FORMAT
+            ", \"col_removed\": %" HIGHSINT_FORMAT
+            ", \"nnz_removed\": %" HIGHSINT_FORMAT
+            ", \"fill_in\": %" HIGHSINT_FORMAT "}%s\n",
+            presolveProfileJsonString(
+                utilPresolveRoutineTypeToString(routine_type))
+                .c_str(),
+            profile.call, profile.time, profile.row_removed,
+            profile.col_removed, profile.nnz_removed, profile.fill_in,
+            routine_type < kPresolveRoutineCount - 1 ? "," : "");
+  }
+  fprintf(file, "  ]\n}\n");
+  fclose(file);
+  return HighsStatus::kOk;
+}
@@ -16,6 +16,8 @@
 #ifndef PRESOLVE_HIGHS_PRESOLVE_ANALYSIS_H_
 #define PRESOLVE_HIGHS_PRESOLVE_ANALYSIS_H_
 
+#include "util/HighsTimer.h"
+
 class HPresolveAnalysis {
   const HighsLp* model;
   const HighsOptions* options;
@@ -29,6 +31,9 @@ class HPresolveAnalysis {
 
  public:
   std::vector<bool> allow_rule_;
+  std::vector<bool> allow_routine_;
+  std::vector<double> routine_time_limit_;
+  std::vector<HighsInt> routine_call_limit_;
 
   bool allow_logging_;
   bool logging_on_;
@@ -38,6 +43,15 @@ class HPresolveAnalysis {
   HighsInt num_deleted_cols0_;
   HighsPresolveLog presolve_log_;
 
+  // for profiling the routines called in the main presolve loop
+  HighsTimer profile_timer_;
+  std::vector<HighsInt> profile_clock_;
+  HighsInt profile_routine_type_;
+  HighsInt profile_num_row0_;
+  HighsInt profile_num_col0_;
+  HighsInt profile_num_nonzeros0_;
+  HighsInt profile_num_fill_in0_;
+
   // for LP presolve
   void setup(const HighsLp* model_, const HighsOptions* options_,
              const HighsInt& numDeletedRows_, const HighsInt& numDeletedCols_);
@@ -47,6 +61,17 @@ class HPresolveAnalysis {
   void startPresolveRuleLog(const HighsInt rule_type);
   void stopPresolveRuleLog(const HighsInt rule_type);
   bool analysePresolveRuleLog(const bool report = false);
+
+  void startPresolveRoutineProfile(const HighsInt routine_type,
+                                   const HighsInt num_nonzeros,
+                                   const HighsInt num_fill_in);
+  void stopPresolveRoutineProfile(const HighsInt routine_type,
+                                  const HighsInt num_nonzeros,
+                                  const HighsInt num_fill_in);
+  bool allowPresolveRoutine(const HighsInt routine_type) const;
+  bool presolveRoutineTimeLimitReached(const HighsInt routine_type);
+  void reportPresolveRoutineProfile();
+  HighsStatus writePresolveRoutineProfile(const std::string& filename);
   friend class HPresolve;
 };
 
@@ -16,6 +16,7 @@
 
 #include "lp_data/HConst.h"
 #include "lp_data/HighsOptions.h"
+#include "util/HighsBinaryIO.h"
 #include "util/HighsCDouble.h"
 
 namespace presolve {
@@ -34,6 +35,28 @@ void HighsPostsolveStack::initializeIndexMaps(HighsInt numRow,
   linearlyTransformable.resize(numCol, true);
 }
 
+void HighsPostsolveStack::write(std::ostream& out) const {
+  highsBinaryWrite(out, reductionValues.getData());
+  highsBinaryWrite(out, reductions);
+  highsBinaryWrite(out, origColIndex);
+  highsBinaryWrite(out, origRowIndex);
+  highsBinaryWrite(out, linearlyTransformable);
+  highsBinaryWrite(out, origNumCol);
+  highsBinaryWrite(out, origNumRow);
+}
+
+bool HighsPostsolveStack::read(std::istream& in) {
+  std::vector<char> data;
+  if (!highsBinaryRead(in, data) || !highsBinaryRead(in, reductions) ||
+      !highsBinaryRead(in, origColIndex) ||
+      !highsBinaryRead(in, origRowIndex) ||
+      !highsBinaryRead(in, linearlyTransformable) ||
+      !highsBinaryRead(in, origNumCol) || !highsBinaryRead(in, origNumRow))
+    return false;
+  reductionValues.setData(std::move(data));
+  return true;
+}
+
 void HighsPostsolveStack::compressIndexMaps(
     const std::vector<HighsInt>& newRowIndex,
     const std::vector<HighsInt>& newColIndex) {
@@ -20,7 +20,9 @@
 
 #include <cassert>
 #include <cmath>
+#include <istream>
 #include <numeric>
+#include <ostream>
 #include <tuple>
 #include <vector>
 
@@ -281,6 +283,12 @@ class HighsPostsolveStack {
 
   void initializeIndexMaps(HighsInt numRow, HighsInt numCol);
 
+  // write the stack to a binary stream, and read it back, which fails if the
+  // stream ends early
+  void write(std::ostream& out) const;
+
+  bool read(std::istream& in);
+
   void compressIndexMaps(const std::vector<HighsInt>& newRowIndex,
                          const std::vector<HighsInt>& newColIndex);
 
@@ -528,6 +536,24 @@ class HighsPostsolveStack {
     return linearlyTransformable[col];
   }
 
+  /// compose the linear transformations of the original columns that were
+  /// made after the first numReductions reductions into x = scale * x' +
+  /// constant
+  void getLinearTransforms(size_t numReductions, std::vector<double>& scale,
+                           std::vector<double>& constant) {
+    scale.assign(origNumCol, 1.0);
+    constant.assign(origNumCol, 0.0);
+    for (size_t i = numReductions; i < reductions.size(); ++i) {
+      if (reductions[i].first != ReductionType::kLinearTransform) continue;
+      reductionValues.setPosition(reductions[i].second);
+      LinearTransform linearTransform;
+      reductionValues.pop(linearTransform);
+      HighsInt col = linearTransform.col;
+      constant[col] += scale[col] * linearTransform.constant;
+      scale[col] *= linearTransform.scale;
+    }
+  }
+
   /// undo presolve steps for primal dual solution and basis
   void undo(const HighsOptions& options, HighsSolution& solution,
             HighsBasis& basis) {
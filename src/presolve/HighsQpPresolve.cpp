@@ -0,0 +1,607 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file presolve/HighsQpPresolve.cpp
+ * @brief Reductions of a QP that account for its Hessian, and their
+ * postsolve
+ */
+#include "presolve/HighsQpPresolve.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <map>
+
+void HighsQpPostsolveRecord::clear() {
+  col_map.clear();
+  row_map.clear();
+  reductions.clear();
+  primal_feasibility_tolerance = 0;
+  num_removed_col = 0;
+  num_removed_row = 0;
+  num_removed_nz = 0;
+  num_removed_hessian_nz = 0;
+}
+
+namespace {
+
+using HighsQpEntries = std::vector<std::pair<HighsInt, double>>;
+
+// Working copy of a QP that is reduced by presolveQp. The constraint
+// matrix is held both row-wise and column-wise, and the Hessian is held
+// as a symmetric matrix, so that entries can be found and updated when
+// a column is substituted out
+class HighsQpPresolve {
+ public:
+  HighsQpPresolve(const HighsOptions& options, const HighsModel& model,
+                  HighsQpPostsolveRecord& record);
+
+  // Makes reductions until none remain, returning false if the QP is
+  // found to be infeasible
+  bool reduce();
+  HighsPresolveStatus formReducedModel(HighsModel& reduced_model);
+
+ private:
+  const HighsOptions& options_;
+  const HighsModel& model_;
+  HighsQpPostsolveRecord& record_;
+  HighsInt num_col_;
+  HighsInt num_row_;
+  double sense_;
+  double offset_;
+  std::vector<double> cost_;
+  std::vector<double> col_lower_;
+  std::vector<double> col_upper_;
+  std::vector<double> row_lower_;
+  std::vector<double> row_upper_;
+  std::vector<std::map<HighsInt, double>> col_entries_;
+  std::vector<std::map<HighsInt, double>> row_entries_;
+  std::vector<std::map<HighsInt, double>> hessian_entries_;
+  std::vector<uint8_t> col_removed_;
+  std::vector<uint8_t> row_removed_;
+
+  void setMatrixEntry(HighsInt row, HighsInt col, double value);
+  void addHessianEntry(HighsInt row, HighsInt col, double value);
+  double hessianDiagonal(HighsInt col) const;
+  bool hessianIsDiagonal(HighsInt col) const;
+  HighsQpReduction& recordReduction(HighsQpReductionType type, HighsInt col,
+                                    HighsInt row);
+  void removeCol(HighsInt col);
+  void removeRow(HighsInt row);
+  void fixCol(HighsInt col, double value);
+  void substituteCol(HighsInt col, HighsInt row, double value,
+                     const HighsQpEntries& substitution);
+  bool emptyCol(HighsInt col);
+  bool freeColSingleton(HighsInt col);
+  bool emptyRow(HighsInt row, bool& infeasible);
+  bool doubletonEquation(HighsInt row, bool& infeasible);
+};
+
+HighsQpPresolve::HighsQpPresolve(const HighsOptions& options,
+                                 const HighsModel& model,
+                                 HighsQpPostsolveRecord& record)
+    : options_(options), model_(model), record_(record) {
+  const HighsLp& lp = model.lp_;
+  const HighsHessian& hessian = model.hessian_;
+  num_col_ = lp.num_col_;
+  num_row_ = lp.num_row_;
+  sense_ = (HighsInt)lp.sense_;
+  offset_ = lp.offset_;
+  cost_ = lp.col_cost_;
+  col_lower_ = lp.col_lower_;
+  col_upper_ = lp.col_upper_;
+  row_lower_ = lp.row_lower_;
+  row_upper_ = lp.row_upper_;
+  col_entries_.resize(num_col_);
+  row_entries_.resize(num_row_);
+  hessian_entries_.resize(num_col_);
+  col_removed_.assign(num_col_, false);
+  row_removed_.assign(num_row_, false);
+  for (HighsInt iCol = 0; iCol < num_col_; iCol++) {
+    for (HighsInt iEl = lp.a_matrix_.start_[iCol];
+         iEl < lp.a_matrix_.start_[iCol + 1]; iEl++)
+      setMatrixEntry(lp.a_matrix_.index_[iEl], iCol, lp.a_matrix_.value_[iEl]);
+    // The triangular Hessian holds each off-diagonal entry once
+    for (HighsInt iEl = hessian.start_[iCol]; iEl < hessian.start_[iCol + 1];
+         iEl++) {
+      const HighsInt iRow = hessian.index_[iEl];
+      hessian_entries_[iCol][iRow] = hessian.value_[iEl];
+      if (iRow != iCol) hessian_entries_[iRow][iCol] = hessian.value_[iEl];
+    }
+  }
+}
+
+void HighsQpPresolve::setMatrixEntry(HighsInt row, HighsInt col,
+                                     double value) {
+  if (std::fabs(value) <= options_.small_matrix_value) {
+    row_entries_[row].erase(col);
+    col_entries_[col].erase(row);
+    return;
+  }
+  row_entries_[row][col] = value;
+  col_entries_[col][row] = value;
+}
+
+void HighsQpPresolve::addHessianEntry(HighsInt row, HighsInt col,
+                                      double value) {
+  std::map<HighsInt, double>& entries = hessian_entries_[col];
+  const double new_value = entries[row] + value;
+  if (std::fabs(new_value) <= options_.small_matrix_value)
+    entries.erase(row);
+  else
+    entries[row] = new_value;
+}
+
+double HighsQpPresolve::hessianDiagonal(HighsInt col) const {
+  auto it = hessian_entries_[col].find(col);
+  return it == hessian_entries_[col].end() ? 0 : it->second;
+}
+
+bool HighsQpPresolve::hessianIsDiagonal(HighsInt col) const {
+  const std::map<HighsInt, double>& entries = hessian_entries_[col];
+  return entries.empty() ||
+         (entries.size() == 1 && entries.begin()->first == col);
+}
+
+HighsQpReduction& HighsQpPresolve::recordReduction(HighsQpReductionType type,
+                                                   HighsInt col,
+                                                   HighsInt row) {
+  record_.reductions.emplace_back();
+  HighsQpReduction& reduction = record_.reductions.back();
+  reduction.type = type;
+  reduction.col = col;
+  reduction.row = row;
+  if (col < 0) return reduction;
+  // Record the data of the column that are needed to compute its dual
+  // value in postsolve
+  reduction.cost = cost_[col];
+  reduction.col_entries.assign(col_entries_[col].begin(),
+                               col_entries_[col].end());
+  reduction.hessian_entries.assign(hessian_entries_[col].begin(),
+                                   hessian_entries_[col].end());
+  reduction.col_lower = col_lower_[col];
+  reduction.col_upper = col_upper_[col];
+  return reduction;
+}
+
+void HighsQpPresolve::removeCol(HighsInt col) {
+  for (const auto& entry : col_entries_[col])
+    row_entries_[entry.first].erase(col);
+  col_entries_[col].clear();
+  for (const auto& entry : hessian_entries_[col])
+    if (entry.first != col) hessian_entries_[entry.first].erase(col);
+  hessian_entries_[col].clear();
+  col_removed_[col] = true;
+}
+
+void HighsQpPresolve::removeRow(HighsInt row) {
+  for (const auto& entry : row_entries_[row])
+    col_entries_[entry.first].erase(row);
+  row_entries_[row].clear();
+  row_removed_[row] = true;
+}
+
+void HighsQpPresolve::fixCol(HighsInt col, double value) {
+  HighsQpReduction& reduction =
+      recordReduction(HighsQpReductionType::kFixedCol, col, -1);
+  reduction.value = value;
+  for (const auto& entry : hessian_entries_[col]) {
+    if (entry.first == col)
+      offset_ += 0.5 * entry.second * value * value;
+    else
+      cost_[entry.first] += entry.second * value;
+  }
+  offset_ += cost_[col] * value;
+  for (const auto& entry : col_entries_[col]) {
+    row_lower_[entry.first] -= entry.second * value;
+    row_upper_[entry.first] -= entry.second * value;
+  }
+  removeCol(col);
+}
+
+// Substitutes col = value - sum_k substitution_k x_k, given by row,
+// into the objective and the other rows, and removes col and row
+void HighsQpPresolve::substituteCol(HighsInt col, HighsInt row, double value,
+                                    const HighsQpEntries& substitution) {
+  const double col_cost = cost_[col];
+  const double diagonal = hessianDiagonal(col);
+  HighsQpEntries off_diagonal;
+  for (const auto& entry : hessian_entries_[col])
+    if (entry.first != col) off_diagonal.push_back(entry);
+  const HighsQpEntries col_entries(col_entries_[col].begin(),
+                                   col_entries_[col].end());
+
+  // With the quadratic terms q of col, the objective gains
+  //
+  //   c x_col + 0.5 q_col,col x_col^2 + sum_m q_m x_m x_col
+  //
+  // so substituting x_col = value - b'x gives the constant c value +
+  // 0.5 q_col,col value^2, the linear terms (value q - (c + q_col,col
+  // value) b)'x and the quadratic terms 0.5 x'(q_col,col bb' - bq' -
+  // qb')x
+  offset_ += col_cost * value + 0.5 * diagonal * value * value;
+  for (const auto& entry : substitution)
+    cost_[entry.first] -= (col_cost + diagonal * value) * entry.second;
+  for (const auto& entry : off_diagonal)
+    cost_[entry.first] += entry.second * value;
+  removeCol(col);
+  if (diagonal != 0) {
+    for (const auto& entry_k : substitution)
+      for (const auto& entry_l : substitution)
+        addHessianEntry(entry_k.first, entry_l.first,
+                        diagonal * entry_k.second * entry_l.second);
+  }
+  for (const auto& entry_k : substitution) {
+    for (const auto& entry_m : off_diagonal) {
+      const double delta = -entry_m.second * entry_k.second;
+      addHessianEntry(entry_k.first, entry_m.first, delta);
+      addHessianEntry(entry_m.first, entry_k.first, delta);
+    }
+  }
+
+  // Substitute into the other rows containing col
+  for (const auto& entry : col_entries) {
+    const HighsInt iRow = entry.first;
+    if (iRow == row) continue;
+    row_lower_[iRow] -= entry.second * value;
+    row_upper_[iRow] -= entry.second * value;
+    for (const auto& entry_k : substitution) {
+      auto it = row_entries_[iRow].find(entry_k.first);
+      const double coefficient =
+          it == row_entries_[iRow].end() ? 0 : it->second;
+      setMatrixEntry(iRow, entry_k.first,
+                     coefficient - entry.second * entry_k.second);
+    }
+  }
+  removeRow(row);
+}
+
+bool HighsQpPresolve::emptyCol(HighsInt col) {
+  if (!col_entries_[col].empty() || !hessianIsDiagonal(col)) return false;
+  // An empty column whose only Hessian entry is on the diagonal is set
+  // to the value minimizing its (convex) contribution to the objective,
+  // unless this is unbounded
+  const double lower = col_lower_[col];
+  const double upper = col_upper_[col];
+  const double linear = sense_ * cost_[col];
+  const double quadratic = sense_ * hessianDiagonal(col);
+  double value;
+  if (quadratic > 0) {
+    value = std::min(std::max(-linear / quadratic, lower), upper);
+  } else if (quadratic < 0) {
+    return false;
+  } else if (linear > 0) {
+    value = lower;
+  } else if (linear < 0) {
+    value = upper;
+  } else {
+    value = lower > -kHighsInf ? lower : upper < kHighsInf ? upper : 0;
+  }
+  if (value <= -kHighsInf || value >= kHighsInf) return false;
+  fixCol(col, value);
+  return true;
+}
+
+bool HighsQpPresolve::freeColSingleton(HighsInt col) {
+  if (col_entries_[col].size() != 1 || col_lower_[col] > -kHighsInf ||
+      col_upper_[col] < kHighsInf)
+    return false;
+  const HighsInt row = col_entries_[col].begin()->first;
+  const double pivot = col_entries_[col].begin()->second;
+  if (row_lower_[row] != row_upper_[row]) return false;
+  // Limit the number of Hessian entries that the substitution can
+  // create
+  const HighsInt substitution_size = row_entries_[row].size() - 1;
+  const HighsInt off_diagonal_size =
+      hessian_entries_[col].size() - (hessianDiagonal(col) != 0);
+  const HighsInt max_fill_in =
+      (hessianDiagonal(col) != 0 ? substitution_size * substitution_size
+                                 : 0) +
+      2 * substitution_size * off_diagonal_size;
+  if (max_fill_in > options_.presolve_substitution_maxfillin) return false;
+
+  HighsQpEntries substitution;
+  for (const auto& entry : row_entries_[row])
+    if (entry.first != col)
+      substitution.emplace_back(entry.first, entry.second / pivot);
+  const double value = row_lower_[row] / pivot;
+  HighsQpReduction& reduction =
+      recordReduction(HighsQpReductionType::kFreeColSingleton, col, row);
+  reduction.value = value;
+  reduction.substitution = substitution;
+  substituteCol(col, row, value, substitution);
+  return true;
+}
+
+bool HighsQpPresolve::emptyRow(HighsInt row, bool& infeasible) {
+  if (!row_entries_[row].empty()) return false;
+  const double tolerance = options_.primal_feasibility_tolerance;
+  if (row_lower_[row] > tolerance || row_upper_[row] < -tolerance) {
+    infeasible = true;
+    return false;
+  }
+  recordReduction(HighsQpReductionType::kEmptyRow, -1, row);
+  row_removed_[row] = true;
+  return true;
+}
+
+bool HighsQpPresolve::doubletonEquation(HighsInt row, bool& infeasible) {
+  if (row_entries_[row].size() != 2 || row_lower_[row] != row_upper_[row])
+    return false;
+  // Substitute out the column with the larger coefficient, so that the
+  // multiple of the other column that replaces it is at most one in
+  // magnitude
+  auto entry_col = row_entries_[row].begin();
+  auto entry_other = std::next(entry_col);
+  if (std::fabs(entry_other->second) > std::fabs(entry_col->second))
+    std::swap(entry_col, entry_other);
+  const HighsInt col = entry_col->first;
+  const HighsInt other = entry_other->first;
+  const double multiplier = entry_other->second / entry_col->second;
+  const double value = row_lower_[row] / entry_col->second;
+
+  // Transfer the bounds of col to other, using x_col = value -
+  // multiplier x_other
+  const double lower = col_lower_[col];
+  const double upper = col_upper_[col];
+  double implied_lower;
+  double implied_upper;
+  if (multiplier > 0) {
+    implied_lower =
+        upper < kHighsInf ? (value - upper) / multiplier : -kHighsInf;
+    implied_upper =
+        lower > -kHighsInf ? (value - lower) / multiplier : kHighsInf;
+  } else {
+    implied_lower =
+        lower > -kHighsInf ? (value - lower) / multiplier : -kHighsInf;
+    implied_upper =
+        upper < kHighsInf ? (value - upper) / multiplier : kHighsInf;
+  }
+  const double other_lower = col_lower_[other];
+  const double other_upper = col_upper_[other];
+  double new_lower = std::max(other_lower, implied_lower);
+  double new_upper = std::min(other_upper, implied_upper);
+  if (new_lower > new_upper) {
+    if (new_lower > new_upper + options_.primal_feasibility_tolerance) {
+      infeasible = true;
+      return false;
+    }
+    new_upper = new_lower;
+  }
+
+  HighsQpReduction& reduction =
+      recordReduction(HighsQpReductionType::kDoubletonEquation, col, row);
+  reduction.value = value;
+  reduction.substitution.emplace_back(other, multiplier);
+  reduction.other_lower = other_lower;
+  reduction.other_upper = other_upper;
+  col_lower_[other] = new_lower;
+  col_upper_[other] = new_upper;
+  substituteCol(col, row, value, reduction.substitution);
+  return true;
+}
+
+bool HighsQpPresolve::reduce() {
+  bool infeasible = false;
+  bool reduced = true;
+  while (reduced) {
+    reduced = false;
+    for (HighsInt iCol = 0; iCol < num_col_; iCol++) {
+      if (col_removed_[iCol]) continue;
+      if (col_lower_[iCol] == col_upper_[iCol]) {
+        fixCol(iCol, col_lower_[iCol]);
+        reduced = true;
+      } else if (emptyCol(iCol) || freeColSingleton(iCol)) {
+        reduced = true;
+      }
+    }
+    for (HighsInt iRow = 0; iRow < num_row_; iRow++) {
+      if (row_removed_[iRow]) continue;
+      if (emptyRow(iRow, infeasible) || doubletonEquation(iRow, infeasible))
+        reduced = true;
+      if (infeasible) return false;
+    }
+  }
+  return true;
+}
+
+HighsPresolveStatus HighsQpPresolve::formReducedModel(
+    HighsModel& reduced_model) {
+  const HighsLp& lp = model_.lp_;
+  record_.col_map.assign(num_col_, -1);
+  record_.row_map.assign(num_row_, -1);
+  HighsInt num_reduced_col = 0;
+  for (HighsInt iCol = 0; iCol < num_col_; iCol++)
+    if (!col_removed_[iCol]) record_.col_map[iCol] = num_reduced_col++;
+  HighsInt num_reduced_row = 0;
+  for (HighsInt iRow = 0; iRow < num_row_; iRow++)
+    if (!row_removed_[iRow]) record_.row_map[iRow] = num_reduced_row++;
+  record_.num_removed_col = num_col_ - num_reduced_col;
+  record_.num_removed_row = num_row_ - num_reduced_row;
+  if (record_.reductions.empty()) return HighsPresolveStatus::kNotReduced;
+
+  // Form the reduced LP. The maps preserve order, so the columns of
+  // the reduced matrix are sorted
+  HighsLp& reduced_lp = reduced_model.lp_;
+  reduced_lp.clear();
+  reduced_lp.model_name_ = lp.model_name_;
+  reduced_lp.sense_ = lp.sense_;
+  reduced_lp.num_col_ = num_reduced_col;
+  reduced_lp.num_row_ = num_reduced_row;
+  reduced_lp.offset_ = offset_;
+  reduced_lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  reduced_lp.a_matrix_.num_col_ = num_reduced_col;
+  reduced_lp.a_matrix_.num_row_ = num_reduced_row;
+  reduced_lp.a_matrix_.start_.assign(1, 0);
+  for (HighsInt iCol = 0; iCol < num_col_; iCol++) {
+    if (col_removed_[iCol]) continue;
+    reduced_lp.col_cost_.push_back(cost_[iCol]);
+    reduced_lp.col_lower_.push_back(col_lower_[iCol]);
+    reduced_lp.col_upper_.push_back(col_upper_[iCol]);
+    for (const auto& entry : col_entries_[iCol]) {
+      assert(record_.row_map[entry.first] >= 0);
+      reduced_lp.a_matrix_.index_.push_back(record_.row_map[entry.first]);
+      reduced_lp.a_matrix_.value_.push_back(entry.second);
+    }
+    reduced_lp.a_matrix_.start_.push_back(
+        reduced_lp.a_matrix_.index_.size());
+  }
+  for (HighsInt iRow = 0; iRow < num_row_; iRow++) {
+    if (row_removed_[iRow]) continue;
+    reduced_lp.row_lower_.push_back(row_lower_[iRow]);
+    reduced_lp.row_upper_.push_back(row_upper_[iRow]);
+  }
+  record_.num_removed_nz =
+      lp.a_matrix_.start_[num_col_] -
+      (HighsInt)reduced_lp.a_matrix_.index_.size();
+
+  // Form the reduced triangular Hessian, with the diagonal entry of
+  // each column first
+  HighsHessian& reduced_hessian = reduced_model.hessian_;
+  reduced_hessian.clear();
+  reduced_hessian.dim_ = num_reduced_col;
+  reduced_hessian.format_ = HessianFormat::kTriangular;
+  for (HighsInt iCol = 0; iCol < num_col_; iCol++) {
+    if (col_removed_[iCol]) continue;
+    reduced_hessian.index_.push_back(record_.col_map[iCol]);
+    reduced_hessian.value_.push_back(hessianDiagonal(iCol));
+    for (const auto& entry : hessian_entries_[iCol]) {
+      if (entry.first <= iCol) continue;
+      reduced_hessian.index_.push_back(record_.col_map[entry.first]);
+      reduced_hessian.value_.push_back(entry.second);
+    }
+    reduced_hessian.start_.push_back(reduced_hessian.index_.size());
+  }
+  record_.num_removed_hessian_nz =
+      model_.hessian_.start_[num_col_] -
+      (HighsInt)reduced_hessian.index_.size();
+
+  highsLogUser(options_.log_options, HighsLogType::kInfo,
+               "QP presolve : Reductions: rows %" HIGHSINT_FORMAT
+               "(-%" HIGHSINT_FORMAT "); columns %" HIGHSINT_FORMAT
+               "(-%" HIGHSINT_FORMAT "); elements %" HIGHSINT_FORMAT
+               "(%+" HIGHSINT_FORMAT "); Hessian elements %" HIGHSINT_FORMAT
+               "(%+" HIGHSINT_FORMAT ")\n",
+               num_reduced_row, record_.num_removed_row, num_reduced_col,
+               record_.num_removed_col,
+               (HighsInt)reduced_lp.a_matrix_.index_.size(),
+               -record_.num_removed_nz,
+               (HighsInt)reduced_hessian.index_.size(),
+               -record_.num_removed_hessian_nz);
+  return num_reduced_col ? HighsPresolveStatus::kReduced
+                         : HighsPresolveStatus::kReducedToEmpty;
+}
+
+}  // namespace
+
+HighsPresolveStatus presolveQp(const HighsOptions& options,
+                               const HighsModel& model,
+                               HighsModel& reduced_model,
+                               HighsQpPostsolveRecord& record) {
+  assert(model.lp_.a_matrix_.isColwise());
+  assert(model.hessian_.format_ == HessianFormat::kTriangular);
+  assert(model.hessian_.dim_ == model.lp_.num_col_);
+  record.clear();
+  record.primal_feasibility_tolerance = options.primal_feasibility_tolerance;
+  HighsQpPresolve presolve(options, model, record);
+  if (!presolve.reduce()) return HighsPresolveStatus::kInfeasible;
+  return presolve.formReducedModel(reduced_model);
+}
+
+void postsolveQp(const HighsModel& model, const HighsQpPostsolveRecord& record,
+                 const HighsSolution& reduced_solution,
+                 HighsSolution& solution) {
+  const HighsLp& lp = model.lp_;
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  solution.value_valid = reduced_solution.value_valid;
+  solution.dual_valid = reduced_solution.dual_valid;
+  if (!solution.value_valid) return;
+  const bool dual_valid = solution.dual_valid;
+
+  std::vector<double>& col_value = solution.col_value;
+  std::vector<double>& col_dual = solution.col_dual;
+  std::vector<double>& row_dual = solution.row_dual;
+  col_value.assign(num_col, 0);
+  col_dual.assign(num_col, 0);
+  row_dual.assign(num_row, 0);
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    const HighsInt iReducedCol = record.col_map[iCol];
+    if (iReducedCol < 0) continue;
+    col_value[iCol] = reduced_solution.col_value[iReducedCol];
+    if (dual_valid) col_dual[iCol] = reduced_solution.col_dual[iReducedCol];
+  }
+  if (dual_valid) {
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      const HighsInt iReducedRow = record.row_map[iRow];
+      if (iReducedRow >= 0)
+        row_dual[iRow] = reduced_solution.row_dual[iReducedRow];
+    }
+  }
+
+  // Undo the reductions in reverse order. When a reduction is undone,
+  // the values of the columns and rows that remained after it are
+  // known, and its own data are those of the model at the time it was
+  // made
+  const double tolerance = record.primal_feasibility_tolerance;
+  for (auto it = record.reductions.rbegin(); it != record.reductions.rend();
+       ++it) {
+    const HighsQpReduction& reduction = *it;
+    if (reduction.type == HighsQpReductionType::kEmptyRow) continue;
+    const HighsInt col = reduction.col;
+    double value = reduction.value;
+    for (const auto& entry : reduction.substitution)
+      value -= entry.second * col_value[entry.first];
+    col_value[col] = value;
+    if (!dual_valid) continue;
+
+    // The dual value of the column is its component of the objective
+    // gradient c + Qx, less its inner product with the row duals
+    double dual = reduction.cost;
+    for (const auto& entry : reduction.hessian_entries)
+      dual += entry.second * col_value[entry.first];
+    double pivot = 0;
+    for (const auto& entry : reduction.col_entries) {
+      if (entry.first == reduction.row)
+        pivot = entry.second;
+      else
+        dual -= entry.second * row_dual[entry.first];
+    }
+    if (reduction.type == HighsQpReductionType::kFixedCol) {
+      col_dual[col] = dual;
+      continue;
+    }
+    // The dual of the removed row is chosen so that the dual of col is
+    // zero, unless col is at one of its bounds and the column
+    // replacing it is strictly between its original bounds. In that
+    // case the dual of the other column is zero, using the fact that
+    // its dual in the reduced model is its dual less multiplier times
+    // the dual of col
+    double removed_col_dual = 0;
+    if (reduction.type == HighsQpReductionType::kDoubletonEquation) {
+      const HighsInt other = reduction.substitution[0].first;
+      const double multiplier = reduction.substitution[0].second;
+      const bool col_interior = value > reduction.col_lower + tolerance &&
+                                value < reduction.col_upper - tolerance;
+      const bool other_interior =
+          col_value[other] > reduction.other_lower + tolerance &&
+          col_value[other] < reduction.other_upper - tolerance;
+      if (!col_interior && other_interior)
+        removed_col_dual = -col_dual[other] / multiplier;
+      col_dual[other] += multiplier * removed_col_dual;
+    }
+    assert(pivot != 0);
+    row_dual[reduction.row] = (dual - removed_col_dual) / pivot;
+    col_dual[col] = removed_col_dual;
+  }
+  lp.a_matrix_.productQuad(solution.row_value, col_value);
+}
@@ -0,0 +1,98 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file presolve/HighsQpPresolve.h
+ * @brief Reductions of a QP that account for its Hessian
+ */
+#ifndef PRESOLVE_HIGHS_QP_PRESOLVE_H_
+#define PRESOLVE_HIGHS_QP_PRESOLVE_H_
+
+#include <utility>
+#include <vector>
+
+#include "lp_data/HStruct.h"
+#include "lp_data/HighsOptions.h"
+#include "model/HighsModel.h"
+
+enum class HighsQpReductionType {
+  // A column is removed at a fixed value: either its bounds are equal,
+  // or it is empty with only a diagonal Hessian entry, and is set to
+  // the value minimizing its contribution to the objective
+  kFixedCol = 0,
+  // An empty row is removed
+  kEmptyRow,
+  // A free column that is a singleton in an equation is substituted out
+  // using the equation, which is removed
+  kFreeColSingleton,
+  // One of the columns of an equation with two nonzeros is substituted
+  // out using the equation, which is removed, after the bounds of the
+  // column are transferred to the other column
+  kDoubletonEquation,
+};
+
+// A reduction made by presolveQp, with the data of the model at the
+// time of the reduction that is needed to postsolve it
+struct HighsQpReduction {
+  HighsQpReductionType type;
+  HighsInt col = -1;
+  HighsInt row = -1;
+  // The value of the removed column is value less the inner product of
+  // substitution with the remaining columns
+  double value = 0;
+  std::vector<std::pair<HighsInt, double>> substitution;
+  // The cost, constraint matrix entries and Hessian entries of the
+  // removed column, and its bounds
+  double cost = 0;
+  std::vector<std::pair<HighsInt, double>> col_entries;
+  std::vector<std::pair<HighsInt, double>> hessian_entries;
+  double col_lower = 0;
+  double col_upper = 0;
+  // For a doubleton equation, the bounds of the other column before
+  // they were tightened by those of the removed column
+  double other_lower = 0;
+  double other_upper = 0;
+};
+
+// Record of the reductions of a QP made by presolveQp, from which
+// postsolveQp recovers a solution of the QP
+struct HighsQpPostsolveRecord {
+  // Index of each original column/row in the reduced QP, or -1 if it
+  // has been removed
+  std::vector<HighsInt> col_map;
+  std::vector<HighsInt> row_map;
+  // The reductions in the order in which they were made
+  std::vector<HighsQpReduction> reductions;
+  double primal_feasibility_tolerance = 0;
+  HighsInt num_removed_col = 0;
+  HighsInt num_removed_row = 0;
+  HighsInt num_removed_nz = 0;
+  HighsInt num_removed_hessian_nz = 0;
+  void clear();
+};
+
+// Removes fixed columns, empty columns whose only Hessian entry is on
+// the diagonal, empty rows, free column singletons in equations and
+// doubleton equations. Columns that are substituted out are
+// substituted into the costs, Hessian, offset and other rows. The
+// model must be column-wise with a triangular Hessian
+HighsPresolveStatus presolveQp(const HighsOptions& options,
+                               const HighsModel& model,
+                               HighsModel& reduced_model,
+                               HighsQpPostsolveRecord& record);
+
+// Recovers the primal and dual values of the QP from those of the
+// reduced QP by undoing the reductions in reverse order
+void postsolveQp(const HighsModel& model, const HighsQpPostsolveRecord& record,
+                 const HighsSolution& reduced_solution,
+                 HighsSolution& solution);
+
+#endif
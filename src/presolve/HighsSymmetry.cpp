@@ -800,13 +800,27 @@ HighsInt HighsSymmetryDetection::getOrbit(HighsInt vertex) {
 }
 
 void HighsSymmetryDetection::initializeHashValues() {
+  // The graph stores each edge in the adjacency lists of both of its
+  // vertices, and the hash values are sums in a finite field that do not
+  // depend on the order of their contributions. Hence the hash value of
+  // each vertex can be gathered from its own neighbourhood independently,
+  // which is done in parallel.
+  std::vector<u32> initialHash(numVertices);
+  highs::parallel::for_each(
+      0, numVertices,
+      [&](HighsInt start, HighsInt end) {
+        for (HighsInt i = start; i < end; ++i) {
+          for (HighsInt j = Gstart[i]; j != Gend[i]; ++j)
+            HighsHashHelpers::sparse_combine32(initialHash[i],
+                                               vertexToCell[Gedge[j].first],
+                                               Gedge[j].second);
+        }
+      },
+      1000);
+
   for (HighsInt i = 0; i != numVertices; ++i) {
-    HighsInt cell = vertexToCell[i];
-    for (HighsInt j = Gstart[i]; j != Gend[i]; ++j) {
-      HighsHashHelpers::sparse_combine32(vertexHash[Gedge[j].first], cell,
-                                         Gedge[j].second);
-    }
-    markCellForRefinement(cell);
+    if (Gstart[i] != Gend[i]) vertexHash[i] = initialHash[i];
+    markCellForRefinement(vertexToCell[i]);
   }
 }
 
@@ -1696,6 +1710,7 @@ void HighsSymmetryDetection::run(HighsSymmetries& symmetries) {
   currNodeCertificate.clear();
   cellCreationStack.clear();
   createNode();
+  numNodes = 1;
   HighsInt maxPerms = 64000000 / numActiveCols;
   HighsSplitDeque* workerDeque = HighsTaskExecutor::getThisWorkerDeque();
   while (!nodeStack.empty()) {
@@ -1842,7 +1857,12 @@ void HighsSymmetryDetection::run(HighsSymmetries& symmetries) {
         continue;
       }
 
+      // stop the search when the node limit is reached, keeping the
+      // automorphisms found so far. They generate a subgroup of the
+      // automorphism group, which is sufficient for handling symmetries.
+      if (numNodes == maxNumNodes) break;
       createNode();
+      ++numNodes;
     }
   }
 
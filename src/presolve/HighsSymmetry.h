@@ -186,6 +186,8 @@ class HighsSymmetryDetection {
   HighsInt bestPathDepth;
 
   HighsInt numAutomorphisms;
+  HighsInt numNodes;
+  HighsInt maxNumNodes = kHighsIInf;
   HighsInt numCol;
   HighsInt numRow;
   HighsInt numVertices;
@@ -279,6 +281,10 @@ class HighsSymmetryDetection {
 
   bool initializeDetection();
 
+  void setMaxNumNodes(HighsInt maxNodes) { maxNumNodes = maxNodes; }
+
+  HighsInt getNumNodes() const { return numNodes; }
+
   void run(HighsSymmetries& symmetries);
 };
 
@@ -0,0 +1,69 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsBinaryIO.h
+ * @brief Reading and writing of trivially copyable values and vectors of
+ * them in binary form
+ */
+#ifndef UTIL_HIGHS_BINARY_IO_H_
+#define UTIL_HIGHS_BINARY_IO_H_
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#include "util/HighsDataStack.h"
+
+template <typename T,
+          typename std::enable_if<IS_TRIVIALLY_COPYABLE(T), int>::type = 0>
+void highsBinaryWrite(std::ostream& out, const T& value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void highsBinaryWrite(std::ostream& out, const std::vector<T>& values) {
+  uint64_t size = values.size();
+  highsBinaryWrite(out, size);
+  if (size != 0)
+    out.write(reinterpret_cast<const char*>(values.data()), size * sizeof(T));
+}
+
+template <typename T,
+          typename std::enable_if<IS_TRIVIALLY_COPYABLE(T), int>::type = 0>
+bool highsBinaryRead(std::istream& in, T& value) {
+  return bool(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+// the size of the vector is checked against the remaining length of the
+// stream before anything is allocated, so that a corrupted file is detected
+// rather than causing a huge allocation
+template <typename T>
+bool highsBinaryRead(std::istream& in, std::vector<T>& values) {
+  uint64_t size;
+  if (!highsBinaryRead(in, size)) return false;
+  std::streampos pos = in.tellg();
+  in.seekg(0, std::ios::end);
+  uint64_t remaining = in.tellg() - pos;
+  in.seekg(pos);
+  if (size > remaining / sizeof(T)) {
+    in.setstate(std::ios::failbit);
+    return false;
+  }
+  values.resize(size);
+  if (size == 0) return true;
+  return bool(
+      in.read(reinterpret_cast<char*>(values.data()), size * sizeof(T)));
+}
+
+#endif
@@ -19,6 +19,7 @@
 
 #include <cstring>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "util/HighsInt.h"
@@ -83,6 +84,13 @@ class HighsDataStack {
   void setPosition(HighsInt position) { this->position = position; }
 
   HighsInt getCurrentDataSize() const { return data.size(); }
+
+  const std::vector<char>& getData() const { return data; }
+
+  void setData(std::vector<char>&& data) {
+    this->data = std::move(data);
+    resetPosition();
+  }
 };
 
 #endif